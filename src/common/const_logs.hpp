@@ -78,6 +78,28 @@ constexpr unsigned ceillog8(unsigned x)
     return x < 8 ? 0 : floorlog8(x - 7) + 1;
 }
 
+/**
+ * @brief Compile time floorlog16
+ * 
+ * @param x Input
+ * @return constexpr unsigned floor(log16(x))
+ */
+constexpr unsigned floorlog16(unsigned x)
+{
+    return x < 16 ? 0 : 1+floorlog16(x >> 4);
+}
+
+/**
+ * @brief Compile time ceil log16
+ * 
+ * @param x Input
+ * @return constexpr unsigned ceil(log16(x))
+ */
+constexpr unsigned ceillog16(unsigned x)
+{
+    return x < 16 ? 0 : floorlog16(x - 15) + 1;
+}
+
 /**
  * @brief Compile time ceil log radix R
  * 
@@ -95,6 +117,9 @@ constexpr unsigned ceillogR(unsigned x, unsigned R){
     if(R == 8){
         return ceillog8(x);
     }
+    if(R == 16){
+        return ceillog16(x);
+    }
     return 0;
 }
 
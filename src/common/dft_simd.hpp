@@ -0,0 +1,577 @@
+/**
+ * @file dft_simd.hpp
+ * @brief This file contains the AVX2 / AVX-512 butterflies, twiddle products and packet shuffles used by the software model in place of the generic code
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef DFT_SIMD_HPP_
+#define DFT_SIMD_HPP_
+
+#include "fast_fixed.hpp"
+
+/**
+ * @brief SIMD version of the dft stage module
+ *
+ * The primary template is disabled : dft() then runs the generic radix cores. The specializations below are
+ * only compiled for the software model, when the host instruction set provides them.
+ *
+ * @tparam DTYPE Data Type
+ * @tparam SW Streaming Width
+ * @tparam RADIX Butterfly radix
+ */
+template<class DTYPE, int SW, int RADIX>
+struct dft_simd {
+    static constexpr bool enabled = false;
+    static void run(const DTYPE[SW], const DTYPE[SW], DTYPE[SW], DTYPE[SW]){}
+};
+
+/**
+ * @brief SIMD version of the twiddle products of fft_sbg_radix_twiddling_stream
+ *
+ * Disabled by default, see dft_simd.
+ *
+ * @tparam DTYPE Data Type
+ * @tparam TTYPE Twiddle factor type
+ * @tparam SW Streaming Width
+ * @tparam RADIX Butterfly radix
+ */
+template<class DTYPE, class TTYPE, int SW, int RADIX>
+struct twiddle_simd {
+    static constexpr bool enabled = false;
+    static void run(const DTYPE[SW], const DTYPE[SW], DTYPE[SW], DTYPE[SW], const TTYPE[2*SW], int){}
+};
+
+/**
+ * @brief SIMD version of the packet shuffle of fft_sbg_radix_table_read : Out[i] = row[lane[i]]
+ *
+ * Disabled by default, see dft_simd.
+ *
+ * @tparam DTYPE Data Type
+ * @tparam SW Streaming Width
+ */
+template<class DTYPE, int SW>
+struct perm_simd {
+    static constexpr bool enabled = false;
+    static void run(const DTYPE[SW], const int32_t[SW], DTYPE[SW]){}
+};
+
+/**
+ * @brief SIMD transpose of a 8x8 block : dst[c*dst_stride + r] = src[r*src_stride + c]
+ *
+ * Disabled by default, see dft_simd.
+ *
+ * @tparam DTYPE Data Type
+ */
+template<class DTYPE>
+struct transpose_simd {
+    static constexpr bool enabled = false;
+    static void run(const DTYPE*, const int64_t, DTYPE*, const int64_t){}
+};
+
+#if !defined(__SYNTHESIS__) && defined(__AVX2__)
+
+#include <immintrin.h>
+
+// GCC 12 reports the _mm512_undefined_* operands of the AVX-512 intrinsics as uninitialized once they are inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/*
+ * The butterflies work in place on the SW samples of a beat : a vector holds 8 (AVX2) or 16 (AVX-512, 8 for double) consecutive
+ * samples, that is SW/RADIX butterflies side by side, and the data exchanges inside a butterfly are in-register
+ * permutations. Every addition, subtraction and product of the generic radix_core is done once, on the same
+ * operands and in the same order, so that the results are bit-identical to the scalar model (float included,
+ * as long as the compiler does not contract the products into FMAs).
+ *
+ * Blend masks are given on 8 lanes, bit i set selecting the second operand in lane i.
+ */
+
+/**
+ * @brief Radix 8 twiddle 1/sqrt(2) and its fast_fixed form, as computed by mult_litt_f, and its double precision
+ * form for the double datapath (mult_litt_type)
+ */
+constexpr int    DFT_SIMD_R8_Q  = 20;
+constexpr float  DFT_SIMD_R8_TW = 0.70710678118654757;
+constexpr double DFT_SIMD_R8_TW_DOUBLE = 0.70710678118654757;
+
+/**
+ * @brief 8 float lanes (AVX2)
+ */
+struct simd_f32x8 {
+    typedef float  scalar_t;
+    typedef __m256 reg_t;
+    static constexpr int LANES = 8;
+
+    static reg_t load(const float* p){ return _mm256_loadu_ps(p); }
+    static void  store(float* p, reg_t a){ _mm256_storeu_ps(p, a); }
+    static reg_t add(reg_t a, reg_t b){ return _mm256_add_ps(a, b); }
+    static reg_t sub(reg_t a, reg_t b){ return _mm256_sub_ps(a, b); }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm256_add_ps(_mm256_mul_ps(a, b), _mm256_mul_ps(c, d)); }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm256_sub_ps(_mm256_mul_ps(a, b), _mm256_mul_ps(c, d)); }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return _mm256_blend_ps(a, b, M); }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return _mm256_permute_ps(a, IMM); }
+    static reg_t swap_halves8(reg_t a){ return _mm256_permute2f128_ps(a, a, 0x01); }
+    static reg_t interleave_halves8(reg_t a){ return _mm256_permutevar8x32_ps(a, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)); }
+    // Products of lanes 5 and 7 by tw and -tw, the other lanes are not used
+    static reg_t mult_r8_tw(reg_t a){
+        return _mm256_mul_ps(_mm256_setr_ps(0, 0, 0, 0, 0, DFT_SIMD_R8_TW, 0, -DFT_SIMD_R8_TW), a);
+    }
+};
+
+/**
+ * @brief 8 fast_fixed<32> lanes (AVX2), with the 32 bits wrap-around of the assignments of the scalar model
+ */
+struct simd_i32x8 {
+    typedef int32_t scalar_t;
+    typedef __m256i reg_t;
+    static constexpr int LANES = 8;
+
+    static reg_t load(const int32_t* p){ return _mm256_loadu_si256((const __m256i*) p); }
+    static void  store(int32_t* p, reg_t a){ _mm256_storeu_si256((__m256i*) p, a); }
+    static reg_t add(reg_t a, reg_t b){ return _mm256_add_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b){ return _mm256_sub_epi32(a, b); }
+    // Low 32 bits of mult_add / mult_sub : (((a*b) >> (Q-1)) +/- ((c*d) >> (Q-1))) >> 1. Only the bits Q-1 to Q+31 of the
+    // products are used, so that logical shifts give the same result as the arithmetic ones (Q <= 32)
+    template<bool SUB>
+    static reg_t mult_addsub_even(reg_t a, reg_t b, reg_t c, reg_t d, __m128i shift){
+        const reg_t x = _mm256_srl_epi64(_mm256_mul_epi32(a, b), shift);
+        const reg_t y = _mm256_srl_epi64(_mm256_mul_epi32(c, d), shift);
+        return _mm256_srli_epi64(SUB ? _mm256_sub_epi64(x, y) : _mm256_add_epi64(x, y), 1);
+    }
+    template<bool SUB>
+    static reg_t mult_addsub(reg_t a, reg_t b, reg_t c, reg_t d, int Q){
+        const __m128i shift = _mm_cvtsi32_si128(Q-1);
+        const reg_t even = mult_addsub_even<SUB>(a, b, c, d, shift);
+        const reg_t odd  = mult_addsub_even<SUB>(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32), _mm256_srli_epi64(c, 32), _mm256_srli_epi64(d, 32), shift);
+        return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int Q){ return mult_addsub<false>(a, b, c, d, Q); }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int Q){ return mult_addsub<true>(a, b, c, d, Q); }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return _mm256_blend_epi32(a, b, M); }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return _mm256_shuffle_epi32(a, IMM); }
+    static reg_t swap_halves8(reg_t a){ return _mm256_permute2x128_si256(a, a, 0x01); }
+    static reg_t interleave_halves8(reg_t a){ return _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)); }
+    // (int32) ((int64) fp_tw * b >> Q) on lanes 5 and 7 : the low 32 bits of the shifted product do not depend on
+    // the kind of shift, the odd lanes are moved to the even ones for the 32x32 -> 64 bits product
+    static reg_t mult_r8_tw(reg_t a){
+        const int32_t tw  = fast_fixed<32>( DFT_SIMD_R8_TW * (1 << DFT_SIMD_R8_Q)).v;
+        const int32_t ntw = fast_fixed<32>(-DFT_SIMD_R8_TW * (1 << DFT_SIMD_R8_Q)).v;
+        const reg_t prod = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_setr_epi32(0, 0, 0, 0, tw, 0, ntw, 0));
+        return _mm256_slli_epi64(_mm256_srli_epi64(prod, DFT_SIMD_R8_Q), 32);
+    }
+};
+
+/**
+ * @brief 8 double lanes (AVX2) held in two registers, lanes 0 to 3 in lo and 4 to 7 in hi
+ */
+struct simd_f64x4x2 {
+    typedef double scalar_t;
+    struct reg_t { __m256d lo, hi; };
+    static constexpr int LANES = 8;
+
+    static reg_t load(const double* p){ return { _mm256_loadu_pd(p), _mm256_loadu_pd(p + 4) }; }
+    static void  store(double* p, reg_t a){ _mm256_storeu_pd(p, a.lo); _mm256_storeu_pd(p + 4, a.hi); }
+    static reg_t add(reg_t a, reg_t b){ return { _mm256_add_pd(a.lo, b.lo), _mm256_add_pd(a.hi, b.hi) }; }
+    static reg_t sub(reg_t a, reg_t b){ return { _mm256_sub_pd(a.lo, b.lo), _mm256_sub_pd(a.hi, b.hi) }; }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int){
+        return { _mm256_add_pd(_mm256_mul_pd(a.lo, b.lo), _mm256_mul_pd(c.lo, d.lo)), _mm256_add_pd(_mm256_mul_pd(a.hi, b.hi), _mm256_mul_pd(c.hi, d.hi)) };
+    }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int){
+        return { _mm256_sub_pd(_mm256_mul_pd(a.lo, b.lo), _mm256_mul_pd(c.lo, d.lo)), _mm256_sub_pd(_mm256_mul_pd(a.hi, b.hi), _mm256_mul_pd(c.hi, d.hi)) };
+    }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return { _mm256_blend_pd(a.lo, b.lo, M & 0xF), _mm256_blend_pd(a.hi, b.hi, (M >> 4) & 0xF) }; }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return { _mm256_permute4x64_pd(a.lo, IMM), _mm256_permute4x64_pd(a.hi, IMM) }; }
+    static reg_t swap_halves8(reg_t a){ return { a.hi, a.lo }; }
+    static reg_t interleave_halves8(reg_t a){
+        const __m256d even = _mm256_unpacklo_pd(a.lo, a.hi); // 0 4 2 6
+        const __m256d odd  = _mm256_unpackhi_pd(a.lo, a.hi); // 1 5 3 7
+        return { _mm256_permute2f128_pd(even, odd, 0x20), _mm256_permute2f128_pd(even, odd, 0x31) };
+    }
+    static reg_t mult_r8_tw(reg_t a){
+        const double tw = DFT_SIMD_R8_TW_DOUBLE;
+        return { _mm256_setzero_pd(), _mm256_mul_pd(_mm256_setr_pd(0, tw, 0, -tw), a.hi) };
+    }
+};
+
+#if defined(__AVX512F__)
+
+/**
+ * @brief 16 float lanes (AVX-512), the 8 lanes patterns are repeated on both halves
+ */
+struct simd_f32x16 {
+    typedef float  scalar_t;
+    typedef __m512 reg_t;
+    static constexpr int LANES = 16;
+
+    static reg_t load(const float* p){ return _mm512_loadu_ps(p); }
+    static void  store(float* p, reg_t a){ _mm512_storeu_ps(p, a); }
+    static reg_t add(reg_t a, reg_t b){ return _mm512_add_ps(a, b); }
+    static reg_t sub(reg_t a, reg_t b){ return _mm512_sub_ps(a, b); }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm512_add_ps(_mm512_mul_ps(a, b), _mm512_mul_ps(c, d)); }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm512_sub_ps(_mm512_mul_ps(a, b), _mm512_mul_ps(c, d)); }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return _mm512_mask_blend_ps((__mmask16) (M | (M << 8)), a, b); }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return _mm512_permute_ps(a, IMM); }
+    static reg_t swap_halves8(reg_t a){ return _mm512_shuffle_f32x4(a, a, 0xB1); }
+    static reg_t interleave_halves8(reg_t a){
+        return _mm512_permutexvar_ps(_mm512_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15), a);
+    }
+    static reg_t mult_r8_tw(reg_t a){
+        const float tw = DFT_SIMD_R8_TW;
+        return _mm512_mul_ps(_mm512_setr_ps(0, 0, 0, 0, 0, tw, 0, -tw, 0, 0, 0, 0, 0, tw, 0, -tw), a);
+    }
+};
+
+/**
+ * @brief 16 fast_fixed<32> lanes (AVX-512)
+ */
+struct simd_i32x16 {
+    typedef int32_t scalar_t;
+    typedef __m512i reg_t;
+    static constexpr int LANES = 16;
+
+    static reg_t load(const int32_t* p){ return _mm512_loadu_si512((const void*) p); }
+    static void  store(int32_t* p, reg_t a){ _mm512_storeu_si512((void*) p, a); }
+    static reg_t add(reg_t a, reg_t b){ return _mm512_add_epi32(a, b); }
+    static reg_t sub(reg_t a, reg_t b){ return _mm512_sub_epi32(a, b); }
+    template<bool SUB>
+    static reg_t mult_addsub_even(reg_t a, reg_t b, reg_t c, reg_t d, __m128i shift){
+        const reg_t x = _mm512_srl_epi64(_mm512_mul_epi32(a, b), shift);
+        const reg_t y = _mm512_srl_epi64(_mm512_mul_epi32(c, d), shift);
+        return _mm512_srli_epi64(SUB ? _mm512_sub_epi64(x, y) : _mm512_add_epi64(x, y), 1);
+    }
+    template<bool SUB>
+    static reg_t mult_addsub(reg_t a, reg_t b, reg_t c, reg_t d, int Q){
+        const __m128i shift = _mm_cvtsi32_si128(Q-1);
+        const reg_t even = mult_addsub_even<SUB>(a, b, c, d, shift);
+        const reg_t odd  = mult_addsub_even<SUB>(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32), _mm512_srli_epi64(c, 32), _mm512_srli_epi64(d, 32), shift);
+        return _mm512_mask_blend_epi32((__mmask16) 0xAAAA, even, _mm512_slli_epi64(odd, 32));
+    }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int Q){ return mult_addsub<false>(a, b, c, d, Q); }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int Q){ return mult_addsub<true>(a, b, c, d, Q); }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return _mm512_mask_blend_epi32((__mmask16) (M | (M << 8)), a, b); }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return _mm512_shuffle_epi32(a, (_MM_PERM_ENUM) IMM); }
+    static reg_t swap_halves8(reg_t a){ return _mm512_shuffle_i32x4(a, a, 0xB1); }
+    static reg_t interleave_halves8(reg_t a){
+        return _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15), a);
+    }
+    static reg_t mult_r8_tw(reg_t a){
+        const int32_t tw  = fast_fixed<32>( DFT_SIMD_R8_TW * (1 << DFT_SIMD_R8_Q)).v;
+        const int32_t ntw = fast_fixed<32>(-DFT_SIMD_R8_TW * (1 << DFT_SIMD_R8_Q)).v;
+        const reg_t prod = _mm512_mul_epi32(_mm512_srli_epi64(a, 32),
+                                            _mm512_setr_epi32(0, 0, 0, 0, tw, 0, ntw, 0, 0, 0, 0, 0, tw, 0, ntw, 0));
+        return _mm512_slli_epi64(_mm512_srli_epi64(prod, DFT_SIMD_R8_Q), 32);
+    }
+};
+
+/**
+ * @brief 8 double lanes (AVX-512)
+ */
+struct simd_f64x8 {
+    typedef double  scalar_t;
+    typedef __m512d reg_t;
+    static constexpr int LANES = 8;
+
+    static reg_t load(const double* p){ return _mm512_loadu_pd(p); }
+    static void  store(double* p, reg_t a){ _mm512_storeu_pd(p, a); }
+    static reg_t add(reg_t a, reg_t b){ return _mm512_add_pd(a, b); }
+    static reg_t sub(reg_t a, reg_t b){ return _mm512_sub_pd(a, b); }
+    static reg_t mult_add(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm512_add_pd(_mm512_mul_pd(a, b), _mm512_mul_pd(c, d)); }
+    static reg_t mult_sub(reg_t a, reg_t b, reg_t c, reg_t d, int){ return _mm512_sub_pd(_mm512_mul_pd(a, b), _mm512_mul_pd(c, d)); }
+    template<int M> static reg_t blend(reg_t a, reg_t b){ return _mm512_mask_blend_pd((__mmask8) M, a, b); }
+    template<int IMM> static reg_t shuffle4(reg_t a){ return _mm512_permutex_pd(a, IMM); }
+    static reg_t swap_halves8(reg_t a){ return _mm512_shuffle_f64x2(a, a, 0x4E); }
+    static reg_t interleave_halves8(reg_t a){ return _mm512_permutexvar_pd(_mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7), a); }
+    static reg_t mult_r8_tw(reg_t a){
+        const double tw = DFT_SIMD_R8_TW_DOUBLE;
+        return _mm512_mul_pd(_mm512_setr_pd(0, 0, 0, 0, 0, tw, 0, -tw), a);
+    }
+};
+
+#endif // __AVX512F__
+
+/**
+ * @brief Radix 2 butterflies on every pair of lanes : (x0 + x1, x0 - x1)
+ */
+template<class V>
+inline typename V::reg_t simd_radix2(typename V::reg_t x){
+    const typename V::reg_t s = V::template shuffle4<0xB1>(x); // x1 x0 x3 x2
+    return V::template blend<0xAA>(V::add(x, s), V::sub(s, x));
+}
+
+/**
+ * @brief Radix 4 butterflies on every group of 4 lanes, same operations as radix_core<DTYPE, 4>
+ */
+template<class V>
+inline void simd_radix4(typename V::reg_t& x_R, typename V::reg_t& x_I){
+    typedef typename V::reg_t reg_t;
+    const reg_t p_R = V::template shuffle4<0x4E>(x_R); // x2 x3 x0 x1
+    const reg_t p_I = V::template shuffle4<0x4E>(x_I);
+    const reg_t sub_R = V::sub(p_R, x_R);              // lanes 2, 3 : x0 - x2, x1 - x3
+
+    // tmp = (x0 + x2, x1 + x3, x0 - x2, -i.(x1 - x3)) in lanes 0 to 3
+    reg_t tmp_R = V::template blend<0x44>(V::add(x_R, p_R), sub_R);
+    reg_t tmp_I = V::template blend<0xCC>(V::add(x_I, p_I), V::sub(p_I, x_I));
+    tmp_R = V::template blend<0x88>(tmp_R, V::sub(p_I, x_I));
+    tmp_I = V::template blend<0x88>(tmp_I, V::sub(x_R, p_R));
+
+    // (tmp0 + tmp2, tmp0 - tmp2, tmp1 + tmp3, tmp1 - tmp3) = (y0, y2, y1, y3)
+    x_R = V::template shuffle4<0xD8>(simd_radix2<V>(tmp_R));
+    x_I = V::template shuffle4<0xD8>(simd_radix2<V>(tmp_I));
+}
+
+/**
+ * @brief Radix 8 butterflies on every group of 8 lanes, same operations as radix_core<DTYPE, 8>
+ *
+ * The first layer combines x[k] and x[k+4], the twiddled upper half and the lower half then go through the radix 4
+ * butterflies, whose outputs are the odd and even outputs of the radix 8 butterfly.
+ */
+template<class V>
+inline void simd_radix8(typename V::reg_t& x_R, typename V::reg_t& x_I){
+    typedef typename V::reg_t reg_t;
+    const reg_t p_R = V::swap_halves8(x_R);            // x4 .. x7 x0 .. x3
+    const reg_t p_I = V::swap_halves8(x_I);
+    const reg_t sub_R = V::sub(p_R, x_R);              // lanes 4 to 7 : x[k] - x[k+4]
+    const reg_t sub_I = V::sub(p_I, x_I);
+
+    // Lanes 0 to 4 : t66, t68, t69, t70, t67, lane 6 : s17
+    reg_t t_R = V::template blend<0xF0>(V::add(x_R, p_R), sub_R);
+    reg_t t_I = V::template blend<0xF0>(V::add(x_I, p_I), sub_I);
+    t_R = V::template blend<0x40>(t_R, sub_I);
+    t_I = V::template blend<0x40>(t_I, V::sub(x_R, p_R));
+
+    // Lane 5 : s16 = tw.(d_R + d_I, d_I - d_R), lane 7 : s18 = -tw.(d_R - d_I, d_R + d_I)
+    const reg_t sum  = V::add(sub_R, sub_I);
+    const reg_t m_R = V::template blend<0x80>(sum, V::sub(sub_R, sub_I));
+    const reg_t m_I = V::template blend<0x20>(sum, V::sub(sub_I, sub_R));
+    t_R = V::template blend<0xA0>(t_R, V::mult_r8_tw(m_R));
+    t_I = V::template blend<0xA0>(t_I, V::mult_r8_tw(m_I));
+
+    simd_radix4<V>(t_R, t_I);
+    x_R = V::interleave_halves8(t_R);
+    x_I = V::interleave_halves8(t_I);
+}
+
+/**
+ * @brief Butterflies of one vector of samples
+ */
+template<class V, int RADIX>
+inline void simd_radix_core(typename V::reg_t& x_R, typename V::reg_t& x_I){
+    if(RADIX == 2){
+        x_R = simd_radix2<V>(x_R);
+        x_I = simd_radix2<V>(x_I);
+    }else if(RADIX == 4){
+        simd_radix4<V>(x_R, x_I);
+    }else{
+        simd_radix8<V>(x_R, x_I);
+    }
+}
+
+/**
+ * @brief Vector types of a data type : 8 lanes, and 16 lanes when available (V16 = V8 otherwise)
+ */
+template<class DTYPE>
+struct simd_lanes;
+
+#if defined(__AVX512F__)
+template< > struct simd_lanes<float>          { typedef simd_f32x8 V8; typedef simd_f32x16 V16; };
+template< > struct simd_lanes<fast_fixed<32>> { typedef simd_i32x8 V8; typedef simd_i32x16 V16; };
+template< > struct simd_lanes<double>         { typedef simd_f64x8 V8; typedef simd_f64x8 V16; };
+#else
+template< > struct simd_lanes<float>          { typedef simd_f32x8 V8; typedef simd_f32x8 V16; };
+template< > struct simd_lanes<fast_fixed<32>> { typedef simd_i32x8 V8; typedef simd_i32x8 V16; };
+template< > struct simd_lanes<double>         { typedef simd_f64x4x2 V8; typedef simd_f64x4x2 V16; };
+#endif
+
+/**
+ * @brief Run the butterflies of a beat by vectors of V::LANES samples
+ */
+template<class V, int RADIX>
+inline int simd_dft_lanes(const typename V::scalar_t* In_R, const typename V::scalar_t* In_I,
+                          typename V::scalar_t* Out_R, typename V::scalar_t* Out_I, int first, const int SW){
+    for(; first + V::LANES <= SW; first += V::LANES){
+        typename V::reg_t x_R = V::load(In_R + first);
+        typename V::reg_t x_I = V::load(In_I + first);
+        simd_radix_core<V, RADIX>(x_R, x_I);
+        V::store(Out_R + first, x_R);
+        V::store(Out_I + first, x_I);
+    }
+    return first;
+}
+
+/**
+ * @brief SIMD dft stage for float, double and fast_fixed<32> data, radix 2, 4 and 8, SW multiple of 8
+ */
+template<class DTYPE, int SW, int RADIX>
+struct dft_simd_lanes {
+    static constexpr bool enabled = ((RADIX == 2) || (RADIX == 4) || (RADIX == 8)) && (SW % 8 == 0);
+
+    static void run(const DTYPE In_R[SW], const DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW]){
+        typedef typename simd_lanes<DTYPE>::V8  V8;
+        typedef typename simd_lanes<DTYPE>::V16 V16;
+        typedef typename V8::scalar_t scalar_t;
+        static_assert(sizeof(DTYPE) == sizeof(scalar_t), "the SIMD dft requires the native layout of the data type");
+
+        const scalar_t* in_R  = reinterpret_cast<const scalar_t*>(In_R);
+        const scalar_t* in_I  = reinterpret_cast<const scalar_t*>(In_I);
+        scalar_t*       out_R = reinterpret_cast<scalar_t*>(Out_R);
+        scalar_t*       out_I = reinterpret_cast<scalar_t*>(Out_I);
+        const int next = simd_dft_lanes<V16, RADIX>(in_R, in_I, out_R, out_I, 0, SW);
+        simd_dft_lanes<V8, RADIX>(in_R, in_I, out_R, out_I, next, SW);
+    }
+};
+
+template<int SW, int RADIX>
+struct dft_simd<float, SW, RADIX> : dft_simd_lanes<float, SW, RADIX> {};
+
+template<int SW, int RADIX>
+struct dft_simd<fast_fixed<32>, SW, RADIX> : dft_simd_lanes<fast_fixed<32>, SW, RADIX> {};
+
+template<int SW, int RADIX>
+struct dft_simd<double, SW, RADIX> : dft_simd_lanes<double, SW, RADIX> {};
+
+/**
+ * @brief Twiddle products of a beat by vectors of V::LANES samples : mult_sub / mult_add of the lanes not using W0
+ */
+template<class V, int RADIX>
+inline int simd_twiddle_lanes(const typename V::scalar_t* In_R, const typename V::scalar_t* In_I,
+                              typename V::scalar_t* Out_R, typename V::scalar_t* Out_I, const typename V::scalar_t* tw, int Q, int first, const int SW){
+    constexpr int W0_LANES = (RADIX == 2) ? 0x55 : ((RADIX == 4) ? 0x11 : 0x01);
+    for(; first + V::LANES <= SW; first += V::LANES){
+        const typename V::reg_t x_R  = V::load(In_R + first);
+        const typename V::reg_t x_I  = V::load(In_I + first);
+        const typename V::reg_t tw_R = V::load(tw + first);
+        const typename V::reg_t tw_I = V::load(tw + SW + first);
+        V::store(Out_R + first, V::template blend<W0_LANES>(V::mult_sub(x_R, tw_R, x_I, tw_I, Q), x_R));
+        V::store(Out_I + first, V::template blend<W0_LANES>(V::mult_add(x_I, tw_R, x_R, tw_I, Q), x_I));
+    }
+    return first;
+}
+
+/**
+ * @brief SIMD twiddle products for float, double and fast_fixed<32> data, radix 2, 4 and 8, SW multiple of 8
+ */
+template<class DTYPE, int SW, int RADIX>
+struct twiddle_simd_lanes {
+    static constexpr bool enabled = dft_simd_lanes<DTYPE, SW, RADIX>::enabled;
+
+    static void run(const DTYPE In_R[SW], const DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW], const DTYPE tw[2*SW], int Q){
+        typedef typename simd_lanes<DTYPE>::V8  V8;
+        typedef typename simd_lanes<DTYPE>::V16 V16;
+        typedef typename V8::scalar_t scalar_t;
+        static_assert(sizeof(DTYPE) == sizeof(scalar_t), "the SIMD twiddling requires the native layout of the data type");
+
+        const scalar_t* in_R  = reinterpret_cast<const scalar_t*>(In_R);
+        const scalar_t* in_I  = reinterpret_cast<const scalar_t*>(In_I);
+        scalar_t*       out_R = reinterpret_cast<scalar_t*>(Out_R);
+        scalar_t*       out_I = reinterpret_cast<scalar_t*>(Out_I);
+        const scalar_t* tw_s  = reinterpret_cast<const scalar_t*>(tw);
+        const int next = simd_twiddle_lanes<V16, RADIX>(in_R, in_I, out_R, out_I, tw_s, Q, 0, SW);
+        simd_twiddle_lanes<V8, RADIX>(in_R, in_I, out_R, out_I, tw_s, Q, next, SW);
+    }
+};
+
+template<int SW, int RADIX>
+struct twiddle_simd<float, float, SW, RADIX> : twiddle_simd_lanes<float, SW, RADIX> {};
+
+template<int SW, int RADIX>
+struct twiddle_simd<fast_fixed<32>, fast_fixed<32>, SW, RADIX> : twiddle_simd_lanes<fast_fixed<32>, SW, RADIX> {};
+
+template<int SW, int RADIX>
+struct twiddle_simd<double, double, SW, RADIX> : twiddle_simd_lanes<double, SW, RADIX> {};
+
+/**
+ * @brief Packet shuffles of 32 bits data : a single permute instruction for SW = 4, 8 (and 16 with AVX-512)
+ *
+ * Wider rows are shuffled by vectors of output lanes : two-source permutes for SW = 32 with AVX-512, permutes of both
+ * halves of the row then a blend for SW = 16 with AVX2, gathers for SW = 32 with AVX2.
+ */
+template<int SW>
+struct perm_simd_32 {
+    static constexpr bool enabled = (SW == 4) || (SW == 8) || (SW == 16) || (SW == 32);
+
+    static void run(const void* row, const int32_t lane[SW], void* Out){
+        if(SW == 4){
+            _mm_storeu_ps((float*) Out, _mm_permutevar_ps(_mm_loadu_ps((const float*) row), _mm_loadu_si128((const __m128i*) lane)));
+        }else if(SW == 8){
+            _mm256_storeu_ps((float*) Out, _mm256_permutevar8x32_ps(_mm256_loadu_ps((const float*) row), _mm256_loadu_si256((const __m256i*) lane)));
+        }
+#if defined(__AVX512F__)
+        else if(SW == 16){
+            _mm512_storeu_ps(Out, _mm512_permutexvar_ps(_mm512_loadu_si512((const void*) lane), _mm512_loadu_ps(row)));
+        }else if(SW == 32){
+            const __m512 lo = _mm512_loadu_ps(row);
+            const __m512 hi = _mm512_loadu_ps((const float*) row + 16);
+            for(int i = 0; i < SW; i += 16)
+                _mm512_storeu_ps((float*) Out + i, _mm512_permutex2var_ps(lo, _mm512_loadu_si512((const void*) (lane + i)), hi));
+        }
+#else
+        else if(SW == 16){
+            const __m256 lo = _mm256_loadu_ps((const float*) row);
+            const __m256 hi = _mm256_loadu_ps((const float*) row + 8);
+            for(int i = 0; i < SW; i += 8){
+                const __m256i idx   = _mm256_loadu_si256((const __m256i*) (lane + i));
+                const __m256  upper = _mm256_castsi256_ps(_mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7)));
+                _mm256_storeu_ps((float*) Out + i, _mm256_blendv_ps(_mm256_permutevar8x32_ps(lo, idx), _mm256_permutevar8x32_ps(hi, idx), upper));
+            }
+        }else if(SW == 32){
+            for(int i = 0; i < SW; i += 8)
+                _mm256_storeu_ps((float*) Out + i, _mm256_i32gather_ps((const float*) row, _mm256_loadu_si256((const __m256i*) (lane + i)), 4));
+        }
+#endif
+    }
+};
+
+template<int SW>
+struct perm_simd<float, SW> {
+    static constexpr bool enabled = perm_simd_32<SW>::enabled;
+    static void run(const float row[SW], const int32_t lane[SW], float Out[SW]){ perm_simd_32<SW>::run(row, lane, Out); }
+};
+
+template<int SW>
+struct perm_simd<fast_fixed<32>, SW> {
+    static constexpr bool enabled = perm_simd_32<SW>::enabled;
+    static void run(const fast_fixed<32> row[SW], const int32_t lane[SW], fast_fixed<32> Out[SW]){ perm_simd_32<SW>::run(row, lane, Out); }
+};
+
+/*
+ * 8x8 transpose in three shuffle levels : 32-bit interleave of row pairs, 64-bit interleave of the pairs, 128-bit
+ * lane exchange.
+ */
+template<>
+struct transpose_simd<float> {
+    static constexpr bool enabled = true;
+    static void run(const float* src, const int64_t src_stride, float* dst, const int64_t dst_stride){
+        __m256 r[8], t[8];
+        for(int i = 0; i < 8; i++)
+            r[i] = _mm256_loadu_ps(src + i*src_stride);
+        for(int i = 0; i < 8; i += 2){
+            t[i]   = _mm256_unpacklo_ps(r[i], r[i+1]);
+            t[i+1] = _mm256_unpackhi_ps(r[i], r[i+1]);
+        }
+        for(int i = 0; i < 8; i += 4){
+            r[i]   = _mm256_shuffle_ps(t[i],   t[i+2], _MM_SHUFFLE(1, 0, 1, 0));
+            r[i+1] = _mm256_shuffle_ps(t[i],   t[i+2], _MM_SHUFFLE(3, 2, 3, 2));
+            r[i+2] = _mm256_shuffle_ps(t[i+1], t[i+3], _MM_SHUFFLE(1, 0, 1, 0));
+            r[i+3] = _mm256_shuffle_ps(t[i+1], t[i+3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        for(int i = 0; i < 4; i++){
+            _mm256_storeu_ps(dst + i*dst_stride,     _mm256_permute2f128_ps(r[i], r[i+4], 0x20));
+            _mm256_storeu_ps(dst + (i+4)*dst_stride, _mm256_permute2f128_ps(r[i], r[i+4], 0x31));
+        }
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // !__SYNTHESIS__ && __AVX2__
+
+#endif // DFT_SIMD_HPP_
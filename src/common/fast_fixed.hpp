@@ -0,0 +1,166 @@
+/**
+ * @file fast_fixed.hpp
+ * @brief This file contains a native integer replacement of ap_int for the software simulation of the datapath
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef FAST_FIXED_HPP_
+#define FAST_FIXED_HPP_
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief Storage of a W bits signed integer : int32_t up to 32 bits, int64_t up to 64 bits, __int128 above
+ */
+template<int W>
+struct fast_fixed_storage {
+    typedef typename std::conditional<(W <= 32), int32_t, typename std::conditional<(W <= 64), int64_t, __int128>::type>::type type;
+    typedef typename std::make_unsigned<type>::type utype;
+};
+
+constexpr int fast_fixed_max(int a, int b){
+    return (a > b) ? a : b;
+}
+
+/**
+ * @brief Truncation toward zero of a floating point value, through int64_t when it fits (the conversion to
+ * __int128 is a library call)
+ */
+constexpr __int128 fast_fixed_trunc(double x){
+    return ((x > -9.2e18) && (x < 9.2e18)) ? (__int128) (int64_t) x : (__int128) x;
+}
+
+/**
+ * @brief W bits signed integer with the ap_int<W> arithmetic
+ *
+ * As with ap_int, the result of an addition is one bit wider than its widest operand, the result of a
+ * multiplication is as wide as its two operands, shifts keep the width, and the assignment to a narrower
+ * type wraps the value. Values are kept sign-extended in a native integer so that the operations compile
+ * to plain integer instructions. W must not exceed 127.
+ *
+ * @tparam W Width in bits
+ */
+template<int W>
+class fast_fixed {
+    static_assert((W > 0) && (W < 128), "fast_fixed width must be in [1, 127]");
+
+public :
+    typedef typename fast_fixed_storage<W>::type  storage_t;
+    typedef typename fast_fixed_storage<W>::utype ustorage_t;
+    static constexpr int STORAGE_BITS = 8 * sizeof(storage_t);
+
+    storage_t v;
+
+    /**
+     * @brief Sign extension of the W low bits of x
+     */
+    template<class T>
+    static constexpr storage_t wrap(T x){
+        return (W == STORAGE_BITS) ? (storage_t) x
+                                   : (storage_t) ((storage_t) ((ustorage_t) x << (STORAGE_BITS - W)) >> (STORAGE_BITS - W));
+    }
+
+    /**
+     * @brief Builds a value from a raw integer already in range
+     */
+    static constexpr fast_fixed raw(storage_t x){
+        fast_fixed r;
+        r.v = x;
+        return r;
+    }
+
+    constexpr fast_fixed() : v(0) {}
+
+    template<int W2>
+    constexpr fast_fixed(const fast_fixed<W2>& x) : v(wrap(x.v)) {}
+
+    template<class T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    constexpr fast_fixed(T x) : v(wrap(x)) {}
+
+    // Floating point values are truncated toward zero, as ap_int does
+    constexpr fast_fixed(double x) : v(wrap(fast_fixed_trunc(x))) {}
+    constexpr fast_fixed(float  x) : v(wrap(fast_fixed_trunc(x))) {}
+
+    template<class T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    explicit constexpr operator T() const {
+        return (T) v;
+    }
+
+    double to_double() const {
+        return (double) v;
+    }
+
+    fast_fixed operator>>(int s) const {
+        return raw(v >> s);
+    }
+
+    fast_fixed operator<<(int s) const {
+        return raw(wrap((ustorage_t) v << s));
+    }
+
+    fast_fixed<W+1> operator-() const {
+        return fast_fixed<W+1>::raw(-(typename fast_fixed<W+1>::storage_t) v);
+    }
+
+    template<int W2>
+    fast_fixed& operator+=(const fast_fixed<W2>& x){
+        v = wrap((typename fast_fixed<fast_fixed_max(W, W2)+1>::storage_t) v + x.v);
+        return *this;
+    }
+
+    template<int W2>
+    fast_fixed& operator-=(const fast_fixed<W2>& x){
+        v = wrap((typename fast_fixed<fast_fixed_max(W, W2)+1>::storage_t) v - x.v);
+        return *this;
+    }
+};
+
+template<int W1, int W2>
+inline fast_fixed<fast_fixed_max(W1, W2)+1> operator+(const fast_fixed<W1>& a, const fast_fixed<W2>& b){
+    typedef fast_fixed<fast_fixed_max(W1, W2)+1> R;
+    return R::raw((typename R::storage_t) a.v + (typename R::storage_t) b.v);
+}
+
+template<int W1, int W2>
+inline fast_fixed<fast_fixed_max(W1, W2)+1> operator-(const fast_fixed<W1>& a, const fast_fixed<W2>& b){
+    typedef fast_fixed<fast_fixed_max(W1, W2)+1> R;
+    return R::raw((typename R::storage_t) a.v - (typename R::storage_t) b.v);
+}
+
+template<int W1, int W2>
+inline fast_fixed<W1+W2> operator*(const fast_fixed<W1>& a, const fast_fixed<W2>& b){
+    typedef fast_fixed<W1+W2> R;
+    return R::raw((typename R::storage_t) a.v * (typename R::storage_t) b.v);
+}
+
+// Native integers behave as 32 bits values, floating point operands give floating point results (as with ap_int)
+
+template<int W> inline auto operator+(const fast_fixed<W>& a, int b){ return a + fast_fixed<32>(b); }
+template<int W> inline auto operator+(int a, const fast_fixed<W>& b){ return fast_fixed<32>(a) + b; }
+template<int W> inline auto operator-(const fast_fixed<W>& a, int b){ return a - fast_fixed<32>(b); }
+template<int W> inline auto operator-(int a, const fast_fixed<W>& b){ return fast_fixed<32>(a) - b; }
+template<int W> inline auto operator*(const fast_fixed<W>& a, int b){ return a * fast_fixed<32>(b); }
+template<int W> inline auto operator*(int a, const fast_fixed<W>& b){ return fast_fixed<32>(a) * b; }
+
+template<int W> inline float  operator*(float  a, const fast_fixed<W>& b){ return a * (float)  b.v; }
+template<int W> inline float  operator*(const fast_fixed<W>& a, float  b){ return (float)  a.v * b; }
+template<int W> inline double operator*(double a, const fast_fixed<W>& b){ return a * (double) b.v; }
+template<int W> inline double operator*(const fast_fixed<W>& a, double b){ return (double) a.v * b; }
+template<int W> inline float  operator/(float  a, const fast_fixed<W>& b){ return a / (float)  b.v; }
+template<int W> inline float  operator/(const fast_fixed<W>& a, float  b){ return (float)  a.v / b; }
+template<int W> inline double operator/(double a, const fast_fixed<W>& b){ return a / (double) b.v; }
+template<int W> inline double operator/(const fast_fixed<W>& a, double b){ return (double) a.v / b; }
+
+template<int W1, int W2> inline bool operator==(const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v == b.v; }
+template<int W1, int W2> inline bool operator!=(const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v != b.v; }
+template<int W1, int W2> inline bool operator< (const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v <  b.v; }
+template<int W1, int W2> inline bool operator> (const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v >  b.v; }
+template<int W1, int W2> inline bool operator<=(const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v <= b.v; }
+template<int W1, int W2> inline bool operator>=(const fast_fixed<W1>& a, const fast_fixed<W2>& b){ return a.v >= b.v; }
+
+#endif // FAST_FIXED_HPP_
@@ -36,6 +36,11 @@ double mult_litt_f(float tw, double b, uint8_t Q){
     return (tw * b);
 }
 
+template< >
+double mult_litt_f(double tw, double b, uint8_t Q){
+    return (tw * b);
+}
+
 template< >
 float mult_add(float a, float b, float c, float d, uint8_t Q)
 {
@@ -70,6 +75,16 @@ double util_scale(double in){
     return in;
 }
 
+template< >
+float util_scale(float in, int log2n){
+    return in * (1.0f / (1 << log2n));
+}
+
+template< >
+double util_scale(double in, int log2n){
+    return in * (1.0 / (1 << log2n));
+}
+
 template< >
 void cmult<float, float, float, float>(float a_r, float a_i, float b_r, float b_i, float& o_r, float& o_i, int Q){
     float x = a_r + a_i;
@@ -15,6 +15,10 @@
 
 #include <cstdint>
 
+#ifndef __SYNTHESIS__
+#include "fast_fixed.hpp"
+#endif
+
 /**
  * @brief Multiplier
  * 
@@ -103,6 +107,37 @@ float mult_litt_f(float tw, float b, uint8_t Q);
 template< >
 double mult_litt_f(float tw, double b, uint8_t Q);
 
+/**
+ * @brief Multiplier by a double precision litteral
+ * 
+ * @tparam DTYPE Data type
+ * @tparam INT_TYPE Ouput
+ * @param tw double precision litteral
+ * @param b Input
+ * @param Q binary shift for fixed point operation
+ * @return INT_TYPE tw*b
+ */
+template<class DTYPE, class INT_TYPE>
+INT_TYPE mult_litt_f(double tw, DTYPE b, uint8_t Q);
+
+template< >
+double mult_litt_f(double tw, double b, uint8_t Q);
+
+/**
+ * @brief Type of the litterals given to mult_litt_f : double for the double datapath, float otherwise
+ * 
+ * @tparam DTYPE Data type
+ */
+template<class DTYPE>
+struct mult_litt_type {
+    typedef float type;
+};
+
+template< >
+struct mult_litt_type<double> {
+    typedef double type;
+};
+
 /**
  * @brief Multiplier-additionner
  * 
@@ -242,6 +277,39 @@ float util_scale(float in);
 template< >
 double util_scale(double in);
 
+/**
+ * @brief Scaling by 2^-log2n (1/N normalization of an inverse transform)
+ * 
+ * @tparam DTYPE Data type
+ * @param in Input data
+ * @param log2n Scaling exponent
+ * @return DTYPE scaled value
+ */
+template<class DTYPE>
+DTYPE util_scale(DTYPE in, int log2n){
+    return (in >> log2n);
+}
+
+/**
+ * @brief Floating point scaling by 2^-log2n
+ * 
+ * @param in Input data
+ * @param log2n Scaling exponent
+ * @return float scaled value
+ */
+template< >
+float util_scale(float in, int log2n);
+
+/**
+ * @brief Floating point scaling by 2^-log2n
+ * 
+ * @param in Input data
+ * @param log2n Scaling exponent
+ * @return double scaled value
+ */
+template< >
+double util_scale(double in, int log2n);
+
 /**
  * @brief Commplex scaling utility function
  * 
@@ -320,4 +388,105 @@ void cmult<float, float, float, float>(float a_r, float a_i, float b_r, float b_
 template< >
 void cmult<double, double, double, double>(double a_r, double a_i, double b_r, double b_i, double& o_r, double& o_i, int Q);
 
+#ifndef __SYNTHESIS__
+
+//
+// Native integer specializations for the fast_fixed<32> data/twiddles and fast_fixed<64> intermediates used by
+// the software simulation. They compute exactly what the generic templates compute with ap_int<32>/ap_int<64>.
+//
+
+/**
+ * @brief fast_fixed Multiplier
+ *
+ * @param a Input data
+ * @param b Input tw
+ * @param Q binary right shift
+ * @return fast_fixed<64> (a*b) >> Q
+ */
+template< >
+inline fast_fixed<64> mult(fast_fixed<32> a, fast_fixed<32> b, uint8_t Q)
+{
+    return fast_fixed<64>::raw(((int64_t) a.v * b.v) >> Q);
+}
+
+/**
+ * @brief fast_fixed Multiplier by a floating point litteral
+ *
+ * @param tw floating point litteral
+ * @param b Input
+ * @param Q binary shift
+ * @return fast_fixed<32> tw*b, wrapped on 32 bits
+ */
+template< >
+inline fast_fixed<32> mult_litt_f(float tw, fast_fixed<32> b, uint8_t Q)
+{
+    const fast_fixed<32> fp_tw = tw * (1 << Q);
+    return fast_fixed<32>::raw((int32_t) (((int64_t) fp_tw.v * b.v) >> Q));
+}
+
+/**
+ * @brief fast_fixed Multiplier-additionner
+ *
+ * The 65 bits sum of the ap_int version is never built : floor((x+y)/2) = (x>>1) + (y>>1) + (x&y&1)
+ *
+ * @param a data in a
+ * @param b tw in b
+ * @param c data in c
+ * @param d tw in d
+ * @param Q binary shift
+ * @return fast_fixed<64> a*b+c*d
+ */
+template< >
+inline fast_fixed<64> mult_add(fast_fixed<32> a, fast_fixed<32> b, fast_fixed<32> c, fast_fixed<32> d, uint8_t Q)
+{
+    const int64_t x = ((int64_t) a.v * b.v) >> (Q-1);
+    const int64_t y = ((int64_t) c.v * d.v) >> (Q-1);
+    return fast_fixed<64>::raw((x >> 1) + (y >> 1) + (x & y & 1));
+}
+
+/**
+ * @brief fast_fixed Multiplier-substractor
+ *
+ * The 65 bits difference of the ap_int version is never built : floor((x-y)/2) = (x>>1) - (y>>1) - (~x&y&1)
+ *
+ * @param a data in a
+ * @param b tw in b
+ * @param c data in c
+ * @param d tw in d
+ * @param Q binary shift
+ * @return fast_fixed<64> a*b-c*d
+ */
+template< >
+inline fast_fixed<64> mult_sub(fast_fixed<32> a, fast_fixed<32> b, fast_fixed<32> c, fast_fixed<32> d, uint8_t Q)
+{
+    const int64_t x = ((int64_t) a.v * b.v) >> (Q-1);
+    const int64_t y = ((int64_t) c.v * d.v) >> (Q-1);
+    return fast_fixed<64>::raw((x >> 1) - (y >> 1) - (~x & y & 1));
+}
+
+/**
+ * @brief fast_fixed Complex multiplier, using 3 multiplier and 5 additioners.
+ *
+ * @param a_r First complex value input data (real)
+ * @param a_i First complex value input data (imag)
+ * @param b_r Second complex value input data (real)
+ * @param b_i Second complex value input data (imag)
+ * @param o_r Complex value output data (real)
+ * @param o_i Complex value output data (imag)
+ * @param Q quantization factor
+ */
+template< >
+inline void cmult<fast_fixed<32>, fast_fixed<32>, fast_fixed<32>, fast_fixed<64> >(fast_fixed<32> a_r, fast_fixed<32> a_i, fast_fixed<32> b_r, fast_fixed<32> b_i, fast_fixed<32>& o_r, fast_fixed<32>& o_i, int Q){
+    const int64_t x  = ((int64_t) a_r.v + a_i.v) >> 1;
+    const int64_t y  = ((int64_t) b_i.v - b_r.v) >> 1;
+    const int64_t z  = ((int64_t) b_r.v + b_i.v) >> 1;
+    const int64_t k1 = (b_r.v * x) >> (Q-1);
+    const int64_t k2 = (a_r.v * y) >> (Q-1);
+    const int64_t k3 = (a_i.v * z) >> (Q-1);
+    o_r = fast_fixed<32>::raw(fast_fixed<32>::wrap((uint64_t) k1 - (uint64_t) k3));
+    o_i = fast_fixed<32>::raw(fast_fixed<32>::wrap((uint64_t) k1 + (uint64_t) k2));
+}
+
+#endif // __SYNTHESIS__
+
 #endif // MULT_ADD_HPP_
\ No newline at end of file
@@ -0,0 +1,186 @@
+/**
+ * @file perm_config_gen.hpp
+ * @brief Compile time generator of the streaming permutation configurations (digit reverse and stride)
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef PERM_CONFIG_GEN_HPP_
+#define PERM_CONFIG_GEN_HPP_
+
+#include "../const_logs.hpp"
+#include "spiral_utils.hpp"
+
+/*
+ * Both permutations of the streaming FFT are bit permutations : the bit b of the input position x is the bit
+ * perm_bit_target(b) of the output position y. With SW = 2^LOG2SW, the LOG2SW low bits of a position are its lane
+ * and the others its packet index.
+ *
+ * The element x is written in the bank bank(x) at the address y >> LOG2SW, then read back at the packet y >> LOG2SW
+ * and routed from its bank to the lane y & (SW-1). Each input lane bit that stays a lane bit keeps its output lane
+ * position, each input lane bit that becomes a packet bit (ordered by output position) takes one of the free bank
+ * positions (ordered), and that bank bit is xored with the packet bit of x landing there, so that neither a written
+ * nor a read packet sees two elements in the same bank. One 2x2 switch stage per such bank bit on each side.
+ */
+
+/**
+ * @brief Streaming permutation kinds
+ */
+enum perm_kind {
+	PERM_DIGIT_REV, /**< Radix R digit reversal, the last digit of the output position being a radix N/R^(M-1) one */
+	PERM_STRIDE     /**< y = (x % R) * N/R + x / R */
+};
+
+/**
+ * @brief Output bit position of an input bit
+ *
+ * @param kind Permutation kind
+ * @param LOG2N log2(N)
+ * @param LOG2R log2(R)
+ * @param b Input bit
+ * @return constexpr int output bit
+ */
+constexpr int perm_bit_target(perm_kind kind, int LOG2N, int LOG2R, int b){
+	if(kind == PERM_DIGIT_REV){
+		// M digits : M-1 radix R ones and a last one of LOG2T bits (LOG2T = LOG2R when N is a power of R)
+		const int M = (LOG2N + LOG2R - 1) / LOG2R;
+		const int LOG2T = LOG2N - (M-1)*LOG2R;
+		return (b < LOG2T) ? ((M-1)*LOG2R + b) : ((M-2 - (b-LOG2T)/LOG2R)*LOG2R + (b-LOG2T)%LOG2R);
+	}
+	return (b < LOG2R) ? (LOG2N - LOG2R + b) : (b - LOG2R);
+}
+
+/**
+ * @brief Input bit position of an output bit
+ *
+ * @param kind Permutation kind
+ * @param LOG2N log2(N)
+ * @param LOG2R log2(R)
+ * @param p Output bit
+ * @return constexpr int input bit
+ */
+constexpr int perm_bit_source(perm_kind kind, int LOG2N, int LOG2R, int p){
+	int b = 0;
+	while(perm_bit_target(kind, LOG2N, LOG2R, b) != p){
+		b++;
+	}
+	return b;
+}
+
+/**
+ * @brief Switch stages of a permutation : the number of lane bits leaving the lane
+ *
+ * @param kind Permutation kind
+ * @param LOG2N log2(N)
+ * @param LOG2SW log2(SW)
+ * @param LOG2R log2(R)
+ * @return constexpr int number of stages
+ */
+constexpr int perm_num_stage(perm_kind kind, int LOG2N, int LOG2SW, int LOG2R){
+	int num_stage = 0;
+	for(int b = 0; b < LOG2SW; b++){
+		if(perm_bit_target(kind, LOG2N, LOG2R, b) >= LOG2SW){
+			num_stage++;
+		}
+	}
+	return num_stage;
+}
+
+/**
+ * @brief Generates a permutation configuration
+ *
+ * @tparam NUM_STAGE permutation stages (perm_num_stage)
+ * @tparam SW streaming width
+ * @tparam LOG2N log2(N)
+ * @tparam LOG2SW log2(SW)
+ * @param kind Permutation kind
+ * @param LOG2R log2(R)
+ * @return constexpr perm_config configuration
+ */
+template<int NUM_STAGE, int SW, int LOG2N, int LOG2SW>
+constexpr perm_config<NUM_STAGE, SW, LOG2N, LOG2SW> perm_config_gen(perm_kind kind, int LOG2R){
+	perm_config<NUM_STAGE, SW, LOG2N, LOG2SW> config{};
+
+	// bank bit of each input lane bit, and the bank bits owning a switch stage
+	int bank_bit[LOG2SW > 0 ? LOG2SW : 1] = {};
+	int free_bit[NUM_STAGE] = {};
+	int s = 0;
+	for(int p = 0; p < LOG2SW; p++){
+		if(perm_bit_source(kind, LOG2N, LOG2R, p) >= LOG2SW){
+			free_bit[s++] = p;
+		}
+	}
+	s = 0;
+	for(int p = LOG2SW; p < LOG2N; p++){
+		const int b = perm_bit_source(kind, LOG2N, LOG2R, p);
+		if(b < LOG2SW){
+			config.r_switch_control_bit[s] = p;
+			bank_bit[b] = free_bit[s++];
+		}
+	}
+	for(int b = 0; b < LOG2SW; b++){
+		const int p = perm_bit_target(kind, LOG2N, LOG2R, b);
+		if(p < LOG2SW){
+			bank_bit[b] = p;
+		}
+	}
+
+	for(int i = 0; i < SW; i++){
+		int idx = 0;
+		for(int b = 0; b < LOG2SW; b++){
+			idx |= ((i >> b) & 1) << bank_bit[b];
+		}
+		config.init_perm_idx[i] = idx;
+	}
+
+	for(s = 0; s < NUM_STAGE; s++){
+		const int bit = free_bit[s];
+		for(int m = 0; m < SW/2; m++){
+			const int lo = ((m >> bit) << (bit+1)) | (m & ((1 << bit) - 1));
+			config.w_switch_connection_idx[s][2*m]   = lo;
+			config.w_switch_connection_idx[s][2*m+1] = lo | (1 << bit);
+			config.r_switch_connection_idx[s][2*m]   = lo;
+			config.r_switch_connection_idx[s][2*m+1] = lo | (1 << bit);
+		}
+		config.w_switch_control_bit[s] = perm_bit_source(kind, LOG2N, LOG2R, bit);
+	}
+
+	for(int j = 0; j < LOG2N-LOG2SW; j++){
+		config.w_addr_bit_seq[j] = perm_bit_source(kind, LOG2N, LOG2R, LOG2N-1-j);
+	}
+
+	return config;
+}
+
+/**
+ * @brief Permutation configuration of a (N, SW, R) configuration
+ *
+ * @tparam KIND Permutation kind
+ * @tparam N fft size
+ * @tparam SW streaming width
+ * @tparam R radix
+ */
+template<perm_kind KIND, int N, int SW, int R>
+struct perm_config_traits {
+	static constexpr int LOG2N = ceillog2(N);
+	static constexpr int LOG2SW = ceillog2(SW);
+	static constexpr int NUM_STAGE = perm_num_stage(KIND, LOG2N, LOG2SW, ceillog2(R));
+	static_assert(NUM_STAGE > 0, "permutation needs N/R >= SW");
+
+	typedef perm_config<NUM_STAGE, SW, LOG2N, LOG2SW> config_t;
+
+	static constexpr config_t config(){
+		return perm_config_gen<NUM_STAGE, SW, LOG2N, LOG2SW>(KIND, ceillog2(R));
+	}
+};
+
+template<int N, int SW, int R>
+using dig_rev_perm = perm_config_traits<PERM_DIGIT_REV, N, SW, R>;
+
+template<int N, int SW, int R>
+using stride_perm = perm_config_traits<PERM_STRIDE, N, SW, R>;
+
+#endif // PERM_CONFIG_GEN_HPP_
@@ -42,10 +42,7 @@
 #define SPIRAL_UTILS_HPP_
 
 #include "../mult_add.hpp"
-#include "stride_perm_num_stage.h"
-#include "stride_perm_config.h"
-#include "dig_rev_perm_num_stage.h"
-#include "dig_rev_perm_config.h"
+#include "../dft_simd.hpp"
 
 #include "ap_int.h"
 
@@ -100,9 +97,51 @@ void radix_core_2(DTYPE In_R[2], DTYPE In_I[2], DTYPE Out_R[2], DTYPE Out_I[2]){
 	Out_I[1] = In_I[0] - In_I[1];
 }
 
+/**
+ * @brief Product by W16^e, internal twiddle factor of the radix 16 butterfly (e in 0, 1, 2, 3, 4, 6, 9)
+ * 
+ * @tparam DTYPE Data type
+ * @param R Data (real), replaced by the product
+ * @param I Data (imag), replaced by the product
+ * @param e Exponent
+ */
+template<class DTYPE>
+void radix_core_16_twiddle(DTYPE &R, DTYPE &I, int e){
+	const int Q = 20;
+	typedef typename mult_litt_type<DTYPE>::type LTYPE;
+	const LTYPE tw = 0.70710678118654757; // 1/sqrt(2)
+	const LTYPE c1 = 0.92387953251128674; // cos(pi/8)
+	const LTYPE s1 = 0.38268343236508978; // sin(pi/8)
+	const DTYPE a = R;
+	const DTYPE b = I;
+
+	if(e == 1){ // (c1, -s1)
+		R = mult_litt_f<DTYPE, DTYPE>(c1, a, Q) + mult_litt_f<DTYPE, DTYPE>(s1, b, Q);
+		I = mult_litt_f<DTYPE, DTYPE>(c1, b, Q) - mult_litt_f<DTYPE, DTYPE>(s1, a, Q);
+	}else if(e == 2){ // (tw, -tw), same product as the radix 8 butterfly
+		R = mult_litt_f<DTYPE, DTYPE>(tw, (a + b), Q);
+		I = mult_litt_f<DTYPE, DTYPE>(tw, (b - a), Q);
+	}else if(e == 3){ // (s1, -c1)
+		R = mult_litt_f<DTYPE, DTYPE>(s1, a, Q) + mult_litt_f<DTYPE, DTYPE>(c1, b, Q);
+		I = mult_litt_f<DTYPE, DTYPE>(s1, b, Q) - mult_litt_f<DTYPE, DTYPE>(c1, a, Q);
+	}else if(e == 4){ // -j
+		R = b;
+		I = -a;
+	}else if(e == 6){ // (-tw, -tw)
+		R = mult_litt_f<DTYPE, DTYPE>(tw, (b - a), Q);
+		I = mult_litt_f<DTYPE, DTYPE>(-tw, (a + b), Q);
+	}else if(e == 9){ // (-c1, s1)
+		R = mult_litt_f<DTYPE, DTYPE>(-c1, a, Q) - mult_litt_f<DTYPE, DTYPE>(s1, b, Q);
+		I = mult_litt_f<DTYPE, DTYPE>(s1, a, Q) - mult_litt_f<DTYPE, DTYPE>(c1, b, Q);
+	}
+}
+
 /**
  * @brief Radix R butterfly
  * 
+ * The radix 16 butterfly is built as 4x4 : radix 4 butterflies on the inputs n2, n2+4, n2+8, n2+12, products by
+ * the internal twiddles W16^(n2*k1), then radix 4 butterflies giving the outputs k1, k1+4, k1+8, k1+12.
+ * 
  * @tparam DTYPE Data type
  * @tparam RADIX Butterfly radix
  * @param In_R Input data packet (real)
@@ -138,7 +177,7 @@ void radix_core(DTYPE In_R[RADIX], DTYPE In_I[RADIX], DTYPE Out_R[RADIX], DTYPE
 		Out_I[3] = tmp_I[1] - tmp_I[3];
 	}else if(RADIX == 8){
 		const int Q = 20;
-		const float tw = 0.70710678118654757; // 1/sqrtf(2);
+		const typename mult_litt_type<DTYPE>::type tw = 0.70710678118654757; // 1/sqrt(2)
 		DTYPE s16_R, s17_R, s18_R, s19_R, s20_R;
 		DTYPE s16_I, s17_I, s18_I, s19_I, s20_I;
 		DTYPE t66_R, t67_R, t68_R, t69_R, t70_R, t71_R, t72_R, t73_R, t74_R, t75_R, t76_R;
@@ -196,6 +235,34 @@ void radix_core(DTYPE In_R[RADIX], DTYPE In_I[RADIX], DTYPE Out_R[RADIX], DTYPE
 		Out_I[3] = t75_I + s20_I;
 		Out_R[7] = t75_R - s20_R; // CMPXSUB(Y[7], t75, s20);
 		Out_I[7] = t75_I - s20_I;
+	}else if(RADIX == 16){
+		DTYPE col_in_R[4], col_in_I[4], col_out_R[4], col_out_I[4];
+		DTYPE tmp_R[4][4], tmp_I[4][4]; // [n2][k1]
+
+		for(int n2 = 0; n2 < 4; n2++){
+			for(int n1 = 0; n1 < 4; n1++){
+				col_in_R[n1] = In_R[4*n1 + n2];
+				col_in_I[n1] = In_I[4*n1 + n2];
+			}
+			radix_core<DTYPE, 4>(col_in_R, col_in_I, col_out_R, col_out_I);
+			for(int k1 = 0; k1 < 4; k1++){
+				tmp_R[n2][k1] = col_out_R[k1];
+				tmp_I[n2][k1] = col_out_I[k1];
+				radix_core_16_twiddle<DTYPE>(tmp_R[n2][k1], tmp_I[n2][k1], n2*k1);
+			}
+		}
+
+		for(int k1 = 0; k1 < 4; k1++){
+			for(int n2 = 0; n2 < 4; n2++){
+				col_in_R[n2] = tmp_R[n2][k1];
+				col_in_I[n2] = tmp_I[n2][k1];
+			}
+			radix_core<DTYPE, 4>(col_in_R, col_in_I, col_out_R, col_out_I);
+			for(int k2 = 0; k2 < 4; k2++){
+				Out_R[k1 + 4*k2] = col_out_R[k2];
+				Out_I[k1 + 4*k2] = col_out_I[k2];
+			}
+		}
 	}
 }
 
@@ -286,6 +353,14 @@ void dft(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW]){
 	#pragma HLS INLINE off
 	#pragma HLS PIPELINE
 
+#ifndef __SYNTHESIS__
+	// Software model : vectorized butterflies when the host provides them (see dft_simd.hpp)
+	if(dft_simd<DTYPE, SW, RADIX>::enabled){
+		dft_simd<DTYPE, SW, RADIX>::run(In_R, In_I, Out_R, Out_I);
+		return;
+	}
+#endif
+
 	DTYPE dft_in_R[SW/RADIX][RADIX], dft_in_I[SW/RADIX][RADIX];
 	DTYPE dft_out_R[SW/RADIX][RADIX], dft_out_I[SW/RADIX][RADIX];
 
@@ -26,13 +26,13 @@ set quantiz {"18"}
 set tw_width {"20"}
 set freq {"50MHz" "100MHz" "200MHz" "300MHz"}
 set int_freq {50 100 200 300}
-set radix {2 4 8}
+set radix {2 4 8 16}
 # set radix {4 8}
-set NFFT { {"64" "128" "256" "512" "1024" "2048" "4096"} {"64" "256" "1024" "4096"} {"64" "512" "4096"} }
+set NFFT { {"64" "128" "256" "512" "1024" "2048" "4096"} {"64" "256" "1024" "4096"} {"64" "512" "4096"} {"256" "4096"} }
 # set NFFT { {"64" "256" "1024" "4096"} {"64" "512" "4096"} }
-set SW { {2 4 8} {4 8} {8} }
+set SW { {2 4 8} {4 8} {8} {16} }
 # set SW { {4 8} {8} }
-set GROUP { {"1" "2" "3" "4" "5" "6"} {"1" "2" "3"} {"1" "2"} }
+set GROUP { {"1" "2" "3" "4" "5" "6"} {"1" "2" "3"} {"1" "2"} {"1" "2"} }
 # set GROUP { {"1" "2" "3"} {"1" "2"} }
 set ftime [clock format [clock seconds] -format "%H.%M.%S-%d.%m.%Y"]
 set csynth_fileout "./${arch}_csynth_report_${ftime}.txt"
@@ -49,10 +49,6 @@ foreach r $radix nfft $NFFT sw $SW group $GROUP {
                     set flags "-DNFFT=${n} \
                                 -DCOS_LUT=COS_LUT_N${n}_Q2_${q} \
                                 -DSIN_LUT=SIN_LUT_N${n}\_Q2_${q} \
-                                -DDIGREV_CONFIG=DIG_REV_PERM_CONFIG_N${n}_SW${s}_R${r} \
-                                -DDIGREV_NUMSTAGE=DIGIT_REV_NUM_STAGE_N${n}_SW${s}_R${r} \
-                                -DSTRIDE_CONFIG=STRIDE_PERM_CONFIG_N${n}_SW${s}_R${r} \
-                                -DSTRIDE_NUMSTAGE=STRIDE_PERM_SWITCH_NUM_STAGE_N${n}_SW${s}_R${r} \
                                 -DSTREAMING_WIDTH=${s} \
                                 -DTW_WIDTH=${tw} \
                                 -DGROUP_SIZE=${g} \
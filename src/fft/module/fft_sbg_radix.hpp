@@ -14,10 +14,26 @@
 #define FFT_SBG_RADIX_HPP_
 
 #include "../../common/const_logs.hpp"
-#include "../../../roms/roms.h"
 #include "fft_sbg_radix_utils.hpp"
 #include "ap_int.h"
 
+/**
+ * @brief Per-instance state of the software model : two stage buffers used as ping-pong buffers
+ *
+ * The stages of the software model run one after the other, so that stage s only needs the buffer written by stage
+ * s-1 : the footprint is 2*SIZE values whatever the number of stages. Two FFTs using distinct contexts can run
+ * concurrently.
+ *
+ * @tparam DTYPE Data type
+ * @tparam SIZE FFT Size
+ * @tparam RADIX Butterfly radix
+ * @tparam SW Streaming Width
+ */
+template<class DTYPE, int SIZE, int RADIX, int SW>
+struct sbg_radix_ctx {
+	DTYPE buf_R[2][SW][SIZE/SW];
+	DTYPE buf_I[2][SW][SIZE/SW];
+};
 
 template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GSTART, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
 void sbg_radix_st_core(	DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW], DTYPE buf_out_R[SW][SIZE/SW], DTYPE buf_out_I[SW][SIZE/SW], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int STAGE, int Q){
@@ -40,140 +56,129 @@ void sbg_radix_st_core(	DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW]
 	butterfly_loop :
 	for(int j = 0; j < SIZE/SW; j++){
 		#pragma HLS PIPELINE
-		fft_sbg_radix_st_dr_buf_read<DTYPE, SIZE, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, rd_flip, first_stage, din_R, din_I, dig_rev_config, stride_config);
+		fft_sbg_radix_st_dr_buf_read<DTYPE, SIZE, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, rd_flip, first_stage, din_R, din_I, dig_rev_config, stride_config, j);
 
 
-		fft_sbg_radix_twiddling<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART>(din_R, din_I, twiddled_data_R, twiddled_data_I, Tw_R, Tw_I, i_stage+1, Q);
+		fft_sbg_radix_twiddling<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART>(din_R, din_I, twiddled_data_R, twiddled_data_I, Tw_R, Tw_I, i_stage+1, Q, j);
 		dft<DTYPE, SW, RADIX>(twiddled_data_R, twiddled_data_I, dout_R, dout_I);
 
-		fft_sbg_radix_stride_buf_write<DTYPE, SIZE, SW, GSTART, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(dout_R, dout_I, buf_out_R, buf_out_I, wt_flip, stride_config);
+		fft_sbg_radix_stride_buf_write<DTYPE, SIZE, SW, GSTART, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(dout_R, dout_I, buf_out_R, buf_out_I, wt_flip, stride_config, j);
 	}	
 }
 
 template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int GSTART, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
-void sbg_radix_grp(DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW], DTYPE buf_out_R[SW][SIZE/SW], DTYPE buf_out_I[SW][SIZE/SW],
+void sbg_radix_grp(DTYPE buf_R[][SW][SIZE/SW], DTYPE buf_I[][SW][SIZE/SW],
 			TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
-	
-	static DTYPE buf_inter_R_0[SW][SIZE/SW], buf_inter_I_0[SW][SIZE/SW];
-	static DTYPE buf_inter_R_1[SW][SIZE/SW], buf_inter_I_1[SW][SIZE/SW];
-	static DTYPE buf_inter_R_2[SW][SIZE/SW], buf_inter_I_2[SW][SIZE/SW];
-	static DTYPE buf_inter_R_3[SW][SIZE/SW], buf_inter_I_3[SW][SIZE/SW];
-	static DTYPE buf_inter_R_4[SW][SIZE/SW], buf_inter_I_4[SW][SIZE/SW];
-	static DTYPE buf_inter_R_5[SW][SIZE/SW], buf_inter_I_5[SW][SIZE/SW];
-	static DTYPE buf_inter_R_6[SW][SIZE/SW], buf_inter_I_6[SW][SIZE/SW];
-	static DTYPE buf_inter_R_7[SW][SIZE/SW], buf_inter_I_7[SW][SIZE/SW];
-	static DTYPE buf_inter_R_8[SW][SIZE/SW], buf_inter_I_8[SW][SIZE/SW];
-	static DTYPE buf_inter_R_9[SW][SIZE/SW], buf_inter_I_9[SW][SIZE/SW];
-	static DTYPE buf_inter_R_10[SW][SIZE/SW], buf_inter_I_10[SW][SIZE/SW];
 
+	// Stage GSTART+k reads buf[GSTART+k] and writes buf[GSTART+k+1]
 	switch(GROUP){
 		case 1:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
 			break;
 		case 2:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
 			break;
 		case 3:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
 			break;
 		case 4:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
 			break;
 		case 5:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
 			break;
 		case 6:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
 			break;
 		case 7:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
 			break;
 		case 8:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_inter_R_6, buf_inter_I_6, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_6, buf_inter_I_6, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+7], buf_I[GSTART+7], buf_R[GSTART+8], buf_I[GSTART+8], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
 			break;
 		case 9:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_inter_R_6, buf_inter_I_6, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_6, buf_inter_I_6, buf_inter_R_7, buf_inter_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_7, buf_inter_I_7, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+7], buf_I[GSTART+7], buf_R[GSTART+8], buf_I[GSTART+8], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+8], buf_I[GSTART+8], buf_R[GSTART+9], buf_I[GSTART+9], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
 			break;
 		case 10:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_inter_R_6, buf_inter_I_6, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_6, buf_inter_I_6, buf_inter_R_7, buf_inter_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_7, buf_inter_I_7, buf_inter_R_8, buf_inter_I_8, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_8, buf_inter_I_8, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+7], buf_I[GSTART+7], buf_R[GSTART+8], buf_I[GSTART+8], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+8], buf_I[GSTART+8], buf_R[GSTART+9], buf_I[GSTART+9], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+9], buf_I[GSTART+9], buf_R[GSTART+10], buf_I[GSTART+10], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
 			break;
 		case 11:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_inter_R_6, buf_inter_I_6, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_6, buf_inter_I_6, buf_inter_R_7, buf_inter_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_7, buf_inter_I_7, buf_inter_R_8, buf_inter_I_8, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_8, buf_inter_I_8, buf_inter_R_9, buf_inter_I_9, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_9, buf_inter_I_9, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+10, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+7], buf_I[GSTART+7], buf_R[GSTART+8], buf_I[GSTART+8], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+8], buf_I[GSTART+8], buf_R[GSTART+9], buf_I[GSTART+9], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+9], buf_I[GSTART+9], buf_R[GSTART+10], buf_I[GSTART+10], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+10], buf_I[GSTART+10], buf_R[GSTART+11], buf_I[GSTART+11], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+10, Q);
 			break;
 		case 12:
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R_0, buf_inter_I_0, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_0, buf_inter_I_0, buf_inter_R_1, buf_inter_I_1, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_1, buf_inter_I_1, buf_inter_R_2, buf_inter_I_2, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_2, buf_inter_I_2, buf_inter_R_3, buf_inter_I_3, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_3, buf_inter_I_3, buf_inter_R_4, buf_inter_I_4, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_4, buf_inter_I_4, buf_inter_R_5, buf_inter_I_5, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_5, buf_inter_I_5, buf_inter_R_6, buf_inter_I_6, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_6, buf_inter_I_6, buf_inter_R_7, buf_inter_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_7, buf_inter_I_7, buf_inter_R_8, buf_inter_I_8, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_8, buf_inter_I_8, buf_inter_R_9, buf_inter_I_9, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_9, buf_inter_I_9, buf_inter_R_10, buf_inter_I_10, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+10, Q);
-			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R_10, buf_inter_I_10, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+11, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+0], buf_I[GSTART+0], buf_R[GSTART+1], buf_I[GSTART+1], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+0, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+1], buf_I[GSTART+1], buf_R[GSTART+2], buf_I[GSTART+2], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+1, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+2], buf_I[GSTART+2], buf_R[GSTART+3], buf_I[GSTART+3], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+2, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+3], buf_I[GSTART+3], buf_R[GSTART+4], buf_I[GSTART+4], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+3, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+4], buf_I[GSTART+4], buf_R[GSTART+5], buf_I[GSTART+5], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+4, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+5], buf_I[GSTART+5], buf_R[GSTART+6], buf_I[GSTART+6], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+5, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+6], buf_I[GSTART+6], buf_R[GSTART+7], buf_I[GSTART+7], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+6, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+7], buf_I[GSTART+7], buf_R[GSTART+8], buf_I[GSTART+8], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+7, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+8], buf_I[GSTART+8], buf_R[GSTART+9], buf_I[GSTART+9], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+8, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+9], buf_I[GSTART+9], buf_R[GSTART+10], buf_I[GSTART+10], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+9, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+10], buf_I[GSTART+10], buf_R[GSTART+11], buf_I[GSTART+11], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+10, Q);
+			sbg_radix_st_core<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GSTART, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[GSTART+11], buf_I[GSTART+11], buf_R[GSTART+12], buf_I[GSTART+12], Tw_R, Tw_I, dig_rev_config, stride_config, GSTART+11, Q);
 			break;
 	}
 }
 
 template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
-void sbg_radix_stages(DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW], DTYPE buf_out_R[SW][SIZE/SW], DTYPE buf_out_I[SW][SIZE/SW],
+void sbg_radix_stages(DTYPE buf_R[][SW][SIZE/SW], DTYPE buf_I[][SW][SIZE/SW],
 			TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
 
 	#pragma HLS INLINE
@@ -181,228 +186,225 @@ void sbg_radix_stages(DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW],
 	constexpr const unsigned M = ceillogR(SIZE, RADIX);
 	constexpr const unsigned divi = M % GROUP;
 	constexpr const unsigned intstages = ((M/GROUP >= 1) && (divi == 0)) ? M/GROUP : M/GROUP+1;
-	constexpr const unsigned n_inter = (intstages > 1) ? intstages - 1 : 1; // avoiding Inter_X dim_1 = 0
 	static_assert(M >= GROUP, "GROUP SHOULD BE <= N_STAGES");
 
-	static DTYPE buf_inter_R[n_inter][SW][SIZE/SW], buf_inter_I[n_inter][SW][SIZE/SW];
-	#pragma HLS ARRAY_PARTITION variable=buf_inter_R complete dim=1
-	#pragma HLS ARRAY_PARTITION variable=buf_inter_I complete dim=1
+	// buf[0] holds the digit-reversed input, buf[s+1] the output of stage s
 
 	if(divi == 0){
 		switch(intstages){
 			case 1:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 2:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 3:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 4:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 5:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_inter_R[3], buf_inter_I[3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[3], buf_inter_I[3], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 6:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_inter_R[3], buf_inter_I[3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[3], buf_inter_I[3], buf_inter_R[4], buf_inter_I[4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[4], buf_inter_I[4], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 7:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 8:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 9:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 10:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 11:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_inter_R[ 9], buf_inter_I[ 9], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 9], buf_inter_I[ 9], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 12:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_inter_R[ 9], buf_inter_I[ 9], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 9], buf_inter_I[ 9], buf_inter_R[10], buf_inter_I[10], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,11*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[10], buf_inter_I[10], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,11*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 		}
 	}
 	else{
 		switch(intstages){
 			case 1:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 2:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 3:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 4:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 5:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_inter_R[3], buf_inter_I[3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[3], buf_inter_I[3], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 6:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[0], buf_inter_I[0], buf_inter_R[1], buf_inter_I[1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[1], buf_inter_I[1], buf_inter_R[2], buf_inter_I[2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[2], buf_inter_I[2], buf_inter_R[3], buf_inter_I[3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[3], buf_inter_I[3], buf_inter_R[4], buf_inter_I[4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[4], buf_inter_I[4], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 7:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 8:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 9:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 10:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 11:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_inter_R[ 9], buf_inter_I[ 9], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 9], buf_inter_I[ 9], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 			case 12:
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, buf_inter_R[0], buf_inter_I[0], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 0], buf_inter_I[ 0], buf_inter_R[ 1], buf_inter_I[ 1], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 1], buf_inter_I[ 1], buf_inter_R[ 2], buf_inter_I[ 2], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 2], buf_inter_I[ 2], buf_inter_R[ 3], buf_inter_I[ 3], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 3], buf_inter_I[ 3], buf_inter_R[ 4], buf_inter_I[ 4], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 4], buf_inter_I[ 4], buf_inter_R[ 5], buf_inter_I[ 5], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 5], buf_inter_I[ 5], buf_inter_R[ 6], buf_inter_I[ 6], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 6], buf_inter_I[ 6], buf_inter_R[ 7], buf_inter_I[ 7], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 7], buf_inter_I[ 7], buf_inter_R[ 8], buf_inter_I[ 8], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 8], buf_inter_I[ 8], buf_inter_R[ 9], buf_inter_I[ 9], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[ 9], buf_inter_I[ 9], buf_inter_R[10], buf_inter_I[10], Tw_R, Tw_I, dig_rev_config, stride_config, Q);
-				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi,11*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_inter_R[10], buf_inter_I[10], buf_out_R, buf_out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 0*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 1*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 2*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 3*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 4*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 5*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 6*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 7*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 8*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, 9*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP,10*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+				sbg_radix_grp<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW,  divi,11*GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 				break;
 		}
 	}
 }
 
-template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE>
+template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, bool INVERSE = false>
 void sbg_radix_buff_fill(DTYPE In_R[SIZE], DTYPE In_I[SIZE], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config){
 	DTYPE packeted_in_R[SW], packeted_in_I[SW];
 	#pragma HLS ARRAY_PARTITION variable=packeted_in_R complete dim=1
@@ -414,14 +416,43 @@ void sbg_radix_buff_fill(DTYPE In_R[SIZE], DTYPE In_I[SIZE], DTYPE buf_R[SW][SIZ
 		#pragma HLS PIPELINE
 		read_in_loop :
 		for(int j = 0; j < SW; j++){
-			packeted_in_R[j] = In_R[SW*i+j];
-			packeted_in_I[j] = In_I[SW*i+j];
+			packeted_in_R[j] = INVERSE ? In_I[SW*i+j] : In_R[SW*i+j];
+			packeted_in_I[j] = INVERSE ? In_R[SW*i+j] : In_I[SW*i+j];
 		}
-		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(packeted_in_R, packeted_in_I, buf_R, buf_I, false, dig_rev_config);
+		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(packeted_in_R, packeted_in_I, buf_R, buf_I, false, dig_rev_config, i);
 	}
 }
 
-template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE>
+/**
+ * @brief Input pass of a windowed transform (STFT) : each sample is multiplied by its window coefficient as it is
+ * read, so that the window costs no pass of its own
+ * 
+ * @param Win Window coefficients, in the twiddle format (Q fractional bits)
+ * @param Q Fractional bits of the window
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, bool INVERSE = false>
+void sbg_radix_buff_fill(DTYPE In_R[SIZE], DTYPE In_I[SIZE], TTYPE Win[SIZE], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, int Q){
+	DTYPE packeted_in_R[SW], packeted_in_I[SW];
+	#pragma HLS ARRAY_PARTITION variable=packeted_in_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=packeted_in_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=Win cyclic factor=SW dim=1
+	buf_fill_loop : 
+	for(int i = 0; i < SIZE/SW; i++){
+		#pragma HLS PIPELINE
+		read_in_loop :
+		for(int j = 0; j < SW; j++){
+			const DTYPE in_R = INVERSE ? In_I[SW*i+j] : In_R[SW*i+j];
+			const DTYPE in_I = INVERSE ? In_R[SW*i+j] : In_I[SW*i+j];
+			packeted_in_R[j] = mult<DTYPE, TTYPE, ITYPE>(in_R, Win[SW*i+j], Q);
+			packeted_in_I[j] = mult<DTYPE, TTYPE, ITYPE>(in_I, Win[SW*i+j], Q);
+		}
+		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(packeted_in_R, packeted_in_I, buf_R, buf_I, false, dig_rev_config, i);
+	}
+}
+
+template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE, bool INVERSE = false, bool SCALE = false>
 void sbg_radix_buff_dump(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config){
 	DTYPE packeted_out_R[SW], packeted_out_I[SW];
 	#pragma HLS ARRAY_PARTITION variable=packeted_out_R complete dim=1
@@ -432,17 +463,61 @@ void sbg_radix_buff_dump(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], DTY
 	buf_dump_loop :
 	for(int i = 0; i < SIZE/SW; i++){
 		#pragma HLS PIPELINE
-		fft_sbg_radix_final_stride_buf_read<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, final_rd_flip, packeted_out_R, packeted_out_I, stride_config);
+		fft_sbg_radix_final_stride_buf_read<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, final_rd_flip, packeted_out_R, packeted_out_I, stride_config, i);
 
 		write_out_loop :
 		for(int j = 0; j < SW; j++){
-			Out_R[SW*i+j] = packeted_out_R[j];
-			Out_I[SW*i+j] = packeted_out_I[j];
+			const DTYPE out_R = INVERSE ? packeted_out_I[j] : packeted_out_R[j];
+			const DTYPE out_I = INVERSE ? packeted_out_R[j] : packeted_out_I[j];
+			Out_R[SW*i+j] = SCALE ? util_scale(out_R, LOG2N) : out_R;
+			Out_I[SW*i+j] = SCALE ? util_scale(out_I, LOG2N) : out_I;
 		}
 	}
 }
 
-template<class DTYPE, class STYPE, class VTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE>
+/**
+ * @brief Output pass of a forward transform fused with the input pass of the inverse one (fast convolution)
+ * 
+ * Each packet of the forward result is read as sbg_radix_buff_dump reads it, multiplied by the filter spectrum, scaled
+ * by 1/SIZE (util_scale) and written swapped, as sbg_radix_buff_fill with INVERSE writes it : the spectrum never
+ * leaves the stage buffers. Scaling the product rather than the inverse output keeps the inverse stages of a fixed
+ * point datapath in the range of the signal.
+ * 
+ * @param Flt_R Filter spectrum (real), in the twiddle format
+ * @param Flt_I Filter spectrum (imag)
+ * @param Q Fractional bits of the filter spectrum
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_radix_buff_mult_fill(DTYPE buf_in_R[SW][SIZE/SW], DTYPE buf_in_I[SW][SIZE/SW], TTYPE Flt_R[SIZE], TTYPE Flt_I[SIZE], DTYPE buf_out_R[SW][SIZE/SW], DTYPE buf_out_I[SW][SIZE/SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
+	DTYPE packeted_R[SW], packeted_I[SW];
+	DTYPE product_R[SW], product_I[SW];
+	#pragma HLS ARRAY_PARTITION variable=packeted_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=packeted_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=product_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=product_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_in_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_in_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_out_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_out_I complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=Flt_R cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=Flt_I cyclic factor=SW dim=1
+	constexpr const bool final_rd_flip = false;
+	buf_mult_loop :
+	for(int i = 0; i < SIZE/SW; i++){
+		#pragma HLS PIPELINE
+		fft_sbg_radix_final_stride_buf_read<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_in_R, buf_in_I, final_rd_flip, packeted_R, packeted_I, stride_config, i);
+
+		mult_loop :
+		for(int j = 0; j < SW; j++){
+			cmult<DTYPE, TTYPE, DTYPE, ITYPE>(packeted_R[j], packeted_I[j], Flt_R[SW*i+j], Flt_I[SW*i+j], product_I[j], product_R[j], Q);
+			product_R[j] = util_scale(product_R[j], LOG2N);
+			product_I[j] = util_scale(product_I[j], LOG2N);
+		}
+		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(product_R, product_I, buf_out_R, buf_out_I, false, dig_rev_config, i);
+	}
+}
+
+template<class DTYPE, class STYPE, class VTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, bool INVERSE = false>
 void sbg_radix_buff_fill_axis(STYPE &In, DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config){
 	DTYPE packeted_in_R[SW], packeted_in_I[SW];
 	VTYPE in_vector;
@@ -458,15 +533,15 @@ void sbg_radix_buff_fill_axis(STYPE &In, DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[S
 			In.read(in_vector);
 
 			// packeted_in_R[j] = In_R[SW*i+j];
-			packeted_in_R[j] = (in_vector.data).range(31, 0);
+			packeted_in_R[j] = INVERSE ? (in_vector.data).range(63, 32) : (in_vector.data).range(31, 0);
 			// packeted_in_I[j] = In_I[SW*i+j];
-			packeted_in_I[j] = (in_vector.data).range(63, 32);
+			packeted_in_I[j] = INVERSE ? (in_vector.data).range(31, 0) : (in_vector.data).range(63, 32);
 		}
-		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(packeted_in_R, packeted_in_I, buf_R, buf_I, false, dig_rev_config);
+		fft_sbg_radix_digrev_buf_write<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(packeted_in_R, packeted_in_I, buf_R, buf_I, false, dig_rev_config, i);
 	}
 }
 
-template<class DTYPE, class STYPE, class VTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE>
+template<class DTYPE, class STYPE, class VTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE, bool INVERSE = false, bool SCALE = false>
 void sbg_radix_buff_dump_axis(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], STYPE &Out, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config){
 	DTYPE packeted_out_R[SW], packeted_out_I[SW];
 	VTYPE out_vector;
@@ -478,13 +553,19 @@ void sbg_radix_buff_dump_axis(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW]
 	buf_dump_loop :
 	for(int i = 0; i < SIZE/SW; i++){
 		#pragma HLS PIPELINE
-		fft_sbg_radix_final_stride_buf_read<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, final_rd_flip, packeted_out_R, packeted_out_I, stride_config);
+		fft_sbg_radix_final_stride_buf_read<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, final_rd_flip, packeted_out_R, packeted_out_I, stride_config, i);
 
 		write_out_loop :
 		for(int j = 0; j < SW; j++){
 			// Out_R[SW*i+j] = packeted_out_R[j];
 			// Out_I[SW*i+j] = packeted_out_I[j];
-			out_vector.data = (packeted_out_I[j],packeted_out_R[j]);
+			DTYPE out_R = INVERSE ? packeted_out_I[j] : packeted_out_R[j];
+			DTYPE out_I = INVERSE ? packeted_out_R[j] : packeted_out_I[j];
+			if(SCALE){
+				out_R = util_scale(out_R, LOG2N);
+				out_I = util_scale(out_I, LOG2N);
+			}
+			out_vector.data = (out_I,out_R);
 			out_vector.keep = -1;
 			out_vector.strb = -1;
 			out_vector.last = ((SW*i+j) >= (SIZE-1)) ? 1 : 0;
@@ -493,14 +574,56 @@ void sbg_radix_buff_dump_axis(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW]
 	}
 }
 
+/**
+ * @brief FFT, using permutations and explicit datapath, on the stage buffers given by the caller
+ * 
+ * @tparam DTYPE Data type
+ * @tparam TTYPE Twiddle factor type
+ * @tparam SIZE FFT Size
+ * @tparam RADIX Butterfly radix
+ * @tparam SW Streaming Width
+ * @param In_R Input vector (real)
+ * @param In_I Input vector (imag)
+ * @param Out_R Output vector (real)
+ * @param Out_I Output vector (imag)
+ * @param Tw_R Twiddle factor (real)
+ * @param Tw_I Twiddle factor (imag)
+ * @tparam INVERSE Inverse transform (real and imaginary parts swapped at the input and the output)
+ * @tparam SCALE Output scaled by 1/SIZE (util_scale)
+ * @param buf_R Stage buffers (real), ceillogR(SIZE, RADIX)+1 of them
+ * @param buf_I Stage buffers (imag)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE, bool INVERSE = false, bool SCALE = false>
+void sbg_radix_fft_buf(DTYPE In_R[SIZE], DTYPE In_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q, DTYPE buf_R[][SW][SIZE/SW], DTYPE buf_I[][SW][SIZE/SW]){
+	#pragma HLS INLINE
+	static_assert(fft_sbg_radix_tail_radix(SIZE, RADIX) == RADIX, "the HLS datapath needs SIZE to be a power of RADIX");
+
+	#pragma HLS ARRAY_PARTITION variable=In_R cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=In_I cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=Out_R cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=Out_I cyclic factor=SW dim=1
+
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+
+	sbg_radix_buff_fill<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, INVERSE>(In_R, In_I, buf_R[0], buf_I[0], dig_rev_config);
+
+	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+
+	sbg_radix_buff_dump<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE, INVERSE, SCALE>(buf_R[M], buf_I[M], Out_R, Out_I, stride_config);
+}
+
 /**
  * @brief FFT, using permutations and explicit datapath
  * 
+ * The stage buffers are static : this is the HLS top-level form, calls must not overlap.
+ * 
  * @tparam DTYPE Data type
  * @tparam TTYPE Twiddle factor type
  * @tparam SIZE FFT Size
  * @tparam RADIX Butterfly radix
  * @tparam SW Streaming Width
+ * @tparam INVERSE Inverse transform (real and imaginary parts swapped at the input and the output)
+ * @tparam SCALE Output scaled by 1/SIZE (util_scale)
  * @param In_R Input vector (real)
  * @param In_I Input vector (imag)
  * @param Out_R Output vector (real)
@@ -508,26 +631,443 @@ void sbg_radix_buff_dump_axis(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW]
  * @param Tw_R Twiddle factor (real)
  * @param Tw_I Twiddle factor (imag)
  */
-template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE, bool INVERSE = false, bool SCALE = false>
 void sbg_radix_fft(DTYPE In_R[SIZE], DTYPE In_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
 	#pragma HLS INLINE
 
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+
+	static DTYPE buf_R[M+1][SW][SIZE/SW], buf_I[M+1][SW][SIZE/SW];
+	#pragma HLS ARRAY_PARTITION variable=buf_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_I complete dim=1
+
+	sbg_radix_fft_buf<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE, INVERSE, SCALE>(In_R, In_I, Out_R, Out_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q, buf_R, buf_I);
+}
+
+/**
+ * @brief Windowed FFT (STFT frame), the window being applied by the input pass (see sbg_radix_buff_fill)
+ * 
+ * The stage buffers are static : this is the HLS top-level form, calls must not overlap.
+ * 
+ * @param Win Window coefficients, in the twiddle format
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_radix_fft_window(DTYPE In_R[SIZE], DTYPE In_I[SIZE], TTYPE Win[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
+	#pragma HLS INLINE
+	static_assert(fft_sbg_radix_tail_radix(SIZE, RADIX) == RADIX, "the HLS datapath needs SIZE to be a power of RADIX");
+
 	#pragma HLS ARRAY_PARTITION variable=In_R cyclic factor=SW dim=1
 	#pragma HLS ARRAY_PARTITION variable=In_I cyclic factor=SW dim=1
 	#pragma HLS ARRAY_PARTITION variable=Out_R cyclic factor=SW dim=1
 	#pragma HLS ARRAY_PARTITION variable=Out_I cyclic factor=SW dim=1
 
-	static DTYPE buf_R_0[SW][SIZE/SW], buf_I_0[SW][SIZE/SW];
-	static DTYPE buf_R_7[SW][SIZE/SW], buf_I_7[SW][SIZE/SW];
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+
+	static DTYPE buf_R[M+1][SW][SIZE/SW], buf_I[M+1][SW][SIZE/SW];
+	#pragma HLS ARRAY_PARTITION variable=buf_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_I complete dim=1
+
+	sbg_radix_buff_fill<DTYPE, TTYPE, ITYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(In_R, In_I, Win, buf_R[0], buf_I[0], dig_rev_config, Q);
+
+	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+
+	sbg_radix_buff_dump<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[M], buf_I[M], Out_R, Out_I, stride_config);
+}
+
+/**
+ * @brief Circular convolution of a frame with a filter spectrum (fast convolution block)
+ * 
+ * Forward transform, spectrum product scaled by 1/SIZE fused between its output pass and the input pass of the
+ * inverse transform (sbg_radix_buff_mult_fill), inverse transform. Overlap-save or overlap-add blocks are built
+ * around it by the caller. The stage buffers are static : this is the HLS top-level form, calls must not overlap.
+ * 
+ * @param Flt_R Filter spectrum (real), in the twiddle format
+ * @param Flt_I Filter spectrum (imag)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_radix_fft_conv(DTYPE In_R[SIZE], DTYPE In_I[SIZE], TTYPE Flt_R[SIZE], TTYPE Flt_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
+	#pragma HLS INLINE
+	static_assert(fft_sbg_radix_tail_radix(SIZE, RADIX) == RADIX, "the HLS datapath needs SIZE to be a power of RADIX");
+
+	#pragma HLS ARRAY_PARTITION variable=In_R cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=In_I cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=Out_R cyclic factor=SW dim=1
+	#pragma HLS ARRAY_PARTITION variable=Out_I cyclic factor=SW dim=1
+
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+
+	static DTYPE buf_R[M+1][SW][SIZE/SW], buf_I[M+1][SW][SIZE/SW];
+	#pragma HLS ARRAY_PARTITION variable=buf_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_I complete dim=1
+
+	sbg_radix_buff_fill<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(In_R, In_I, buf_R[0], buf_I[0], dig_rev_config);
+
+	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+
+	sbg_radix_buff_mult_fill<DTYPE, TTYPE, ITYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R[M], buf_I[M], Flt_R, Flt_I, buf_R[0], buf_I[0], dig_rev_config, stride_config, Q);
+
+	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+
+	sbg_radix_buff_dump<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE, true>(buf_R[M], buf_I[M], Out_R, Out_I, stride_config);
+}
+
+#ifndef __SYNTHESIS__
+
+#include <vector>
+
+/**
+ * @brief Stage of the software model
+ * 
+ * Same datapath as sbg_radix_st_core, on packet-major buffers : the switch networks are replaced by the compiled
+ * permutation tables and the twiddle addressing by the stage twiddle stream (see fft_sbg_radix_perm_table_compile
+ * and fft_sbg_radix_tw_stream_fill).
+ * 
+ * @param read_table Permutation tables of the buffer read (digit-reverse ones for the first stage)
+ * @param stride_table Permutation tables of the stride permutation
+ * @param tw_stream Twiddle stream of the stage, (SIZE/SW) beats of 2*SW values
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_st_core_sw(const DTYPE buf_in_R[SIZE], const DTYPE buf_in_I[SIZE], DTYPE buf_out_R[SIZE], DTYPE buf_out_I[SIZE], const TTYPE* tw_stream, const fft_sbg_radix_perm_table<SIZE, SW>& read_table, const fft_sbg_radix_perm_table<SIZE, SW>& stride_table, int Q){
+	DTYPE din_R[SW], din_I[SW];
+	DTYPE dout_R[SW], dout_I[SW];
+	DTYPE twiddled_data_R[SW], twiddled_data_I[SW];
+
+	for(int j = 0; j < SIZE/SW; j++, tw_stream += 2*SW){
+		fft_sbg_radix_table_read<DTYPE, SIZE, SW>(buf_in_R, buf_in_I, din_R, din_I, read_table, j);
+
+		fft_sbg_radix_twiddling_stream<DTYPE, TTYPE, ITYPE, RADIX, SW>(din_R, din_I, twiddled_data_R, twiddled_data_I, tw_stream, Q);
+		dft<DTYPE, SW, RADIX>(twiddled_data_R, twiddled_data_I, dout_R, dout_I);
+
+		fft_sbg_radix_table_write<DTYPE, SIZE, SW>(dout_R, dout_I, buf_out_R, buf_out_I, stride_table, j);
+	}
+}
+
+/**
+ * @brief Stages of the software model, from the digit-reverse read of the first one to the last stride write
+ * 
+ * Stage s reads buf[(first+s)%2] and writes buf[(first+s+1)%2] : the result is left in buf[(first+M)%2].
+ * 
+ * @param first Context buffer written by the input pass
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_stages_sw(DTYPE buf_R[2][SIZE], DTYPE buf_I[2][SIZE], const int first, const TTYPE* tw_stream, const fft_sbg_radix_perm_table<SIZE, SW>& dig_rev_table, const fft_sbg_radix_perm_table<SIZE, SW>& stride_table, const fft_sbg_radix_perm_table<SIZE, SW>& tail_stride_table, int Q){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	constexpr const int TAIL_RADIX = fft_sbg_radix_tail_radix(SIZE, RADIX);
+
+	for(unsigned s = 0; s+1 < M; s++)
+		sbg_radix_st_core_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R[(first+s) % 2], buf_I[(first+s) % 2], buf_R[(first+s+1) % 2], buf_I[(first+s+1) % 2], tw_stream + s*(SIZE/SW)*2*SW, (s == 0) ? dig_rev_table : stride_table, stride_table, Q);
+
+	sbg_radix_st_core_sw<DTYPE, TTYPE, ITYPE, SIZE, TAIL_RADIX, SW>(buf_R[(first+M-1) % 2], buf_I[(first+M-1) % 2], buf_R[(first+M) % 2], buf_I[(first+M) % 2], tw_stream + (M-1)*(SIZE/SW)*2*SW, (M == 1) ? dig_rev_table : stride_table, tail_stride_table, Q);
+}
+
+/**
+ * @brief FFT of the software model, reentrant form
+ * 
+ * Stages run one after the other whatever the stage grouping, which only matters to the HLS datapath : the results
+ * are the ones of sbg_radix_fft, which stays the reference for synthesis and cross-checking. The context buffers
+ * are used packet-major, stage s reading buf[s%2] and writing buf[(s+1)%2].
+ * 
+ * Mixed radix plans (SIZE not a power of RADIX) run their last stage with the tail radix, written and read back
+ * through the stride permutation of that radix.
+ * 
+ * @param tw_stream Twiddle stream built by fft_sbg_radix_tw_stream_fill
+ * @param dig_rev_table Compiled digit-reverse permutation
+ * @param stride_table Compiled stride permutation
+ * @param tail_stride_table Compiled stride permutation of the last stage (stride_table for a pure radix plan)
+ * @param ctx Per-instance state, one per concurrent FFT
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_fft_sw(const DTYPE In_R[SIZE], const DTYPE In_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], const TTYPE* tw_stream, const fft_sbg_radix_perm_table<SIZE, SW>& dig_rev_table, const fft_sbg_radix_perm_table<SIZE, SW>& stride_table, const fft_sbg_radix_perm_table<SIZE, SW>& tail_stride_table, int Q, sbg_radix_ctx<DTYPE, SIZE, RADIX, SW>& ctx){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	DTYPE (*buf_R)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_R);
+	DTYPE (*buf_I)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_I);
+
+	for(int j = 0; j < SIZE/SW; j++)
+		fft_sbg_radix_table_write<DTYPE, SIZE, SW>(In_R + j*SW, In_I + j*SW, buf_R[0], buf_I[0], dig_rev_table, j);
+
+	sbg_radix_stages_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, 0, tw_stream, dig_rev_table, stride_table, tail_stride_table, Q);
+
+	for(int j = 0; j < SIZE/SW; j++)
+		fft_sbg_radix_table_read<DTYPE, SIZE, SW>(buf_R[M % 2], buf_I[M % 2], Out_R + j*SW, Out_I + j*SW, tail_stride_table, j);
+}
+
+/**
+ * @brief Circular convolution of a frame with a filter spectrum, software model form of sbg_radix_fft_conv
+ * 
+ * Each packet of the forward result is read as the output pass reads it, multiplied by the filter spectrum
+ * (cmult), scaled by 1/SIZE (util_scale) and written swapped by the input pass of the inverse transform into the
+ * other context buffer : the spectrum never leaves the context. The output pass of the inverse transform swaps the
+ * result back.
+ * 
+ * @param Flt_R Filter spectrum (real), in the twiddle format
+ * @param Flt_I Filter spectrum (imag)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_fft_conv_sw(const DTYPE In_R[SIZE], const DTYPE In_I[SIZE], const TTYPE Flt_R[SIZE], const TTYPE Flt_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], const TTYPE* tw_stream, const fft_sbg_radix_perm_table<SIZE, SW>& dig_rev_table, const fft_sbg_radix_perm_table<SIZE, SW>& stride_table, const fft_sbg_radix_perm_table<SIZE, SW>& tail_stride_table, int Q, sbg_radix_ctx<DTYPE, SIZE, RADIX, SW>& ctx){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	DTYPE (*buf_R)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_R);
+	DTYPE (*buf_I)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_I);
+	DTYPE packeted_R[SW], packeted_I[SW];
+	DTYPE product_R[SW], product_I[SW];
+
+	for(int j = 0; j < SIZE/SW; j++)
+		fft_sbg_radix_table_write<DTYPE, SIZE, SW>(In_R + j*SW, In_I + j*SW, buf_R[0], buf_I[0], dig_rev_table, j);
+
+	sbg_radix_stages_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, 0, tw_stream, dig_rev_table, stride_table, tail_stride_table, Q);
+
+	for(int j = 0; j < SIZE/SW; j++){
+		fft_sbg_radix_table_read<DTYPE, SIZE, SW>(buf_R[M % 2], buf_I[M % 2], packeted_R, packeted_I, tail_stride_table, j);
+		for(int k = 0; k < SW; k++){
+			cmult<DTYPE, TTYPE, DTYPE, ITYPE>(packeted_R[k], packeted_I[k], Flt_R[SW*j+k], Flt_I[SW*j+k], product_I[k], product_R[k], Q);
+			product_R[k] = util_scale(product_R[k], ceillog2(SIZE));
+			product_I[k] = util_scale(product_I[k], ceillog2(SIZE));
+		}
+		fft_sbg_radix_table_write<DTYPE, SIZE, SW>(product_R, product_I, buf_R[(M+1) % 2], buf_I[(M+1) % 2], dig_rev_table, j);
+	}
+
+	sbg_radix_stages_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, (M+1) % 2, tw_stream, dig_rev_table, stride_table, tail_stride_table, Q);
+
+	for(int j = 0; j < SIZE/SW; j++)
+		fft_sbg_radix_table_read<DTYPE, SIZE, SW>(buf_R[1], buf_I[1], Out_I + j*SW, Out_R + j*SW, tail_stride_table, j);
+}
+
+/**
+ * @brief Work done on a packet of the fast engine when the transform is pruned
+ */
+enum fft_sbg_radix_packet : uint8_t {
+	FFT_SBG_RADIX_PACKET_COMPUTE,	// twiddling and dft
+	FFT_SBG_RADIX_PACKET_COPY,		// only input 0 of each butterfly may be non zero : its untwiddled value goes to the RADIX outputs
+	FFT_SBG_RADIX_PACKET_ZERO,		// all inputs are zero : the outputs are zeroed
+	FFT_SBG_RADIX_PACKET_SKIP		// no output is read by the next stages : nothing is written
+};
+
+/**
+ * @brief Per-stage packet masks of a pruned transform of the fast engine
+ * 
+ * The input samples from valid onward are known to be zero and only the bins first..last are read. The positions
+ * that may hold a non zero value are propagated forward from the digit-reverse gather, and the positions that are
+ * read are propagated backward from the bins, both through the stride permutation folded in the stage writes
+ * (output k of butterfly g at position k*(SIZE/RADIX)+g). The packets keep their whole dft as soon as one of them
+ * needs it, so that the outputs that are computed stay bit-identical to the unpruned transform.
+ * 
+ * With the digit-reverse order of the first stage, a butterfly only loses inputs when valid <= SIZE/RADIX^j, and
+ * only loses outputs when the band is narrower than SIZE/RADIX^j : the pruned work is the one of the first or last j
+ * stages.
+ * 
+ * @param dig_rev Digit-reverse indices (fft_sbg_radix_dig_rev_index)
+ * @param valid Number of leading input samples that may be non zero
+ * @param first First bin read
+ * @param last Last bin read
+ * @param packets Packet actions, ceillogR(SIZE, RADIX) stages of SIZE/W packets (W = fft_sbg_radix_fast_width(SIZE))
+ * @return int Number of packets left to FFT_SBG_RADIX_PACKET_COMPUTE
+ */
+template<int SIZE, int RADIX>
+int fft_sbg_radix_prune_fill(const int32_t dig_rev[SIZE], int32_t valid, int32_t first, int32_t last, uint8_t* packets){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	constexpr int W = fft_sbg_radix_fast_width(SIZE);
+	// position p of stage s input at [s*SIZE + p], the bins at [M*SIZE + p]
+	std::vector<uint8_t> live((M+1)*SIZE), read((M+1)*SIZE);
+
+	for(int p = 0; p < SIZE; p++)
+		live[p] = (dig_rev[p] < valid);
+	for(unsigned s = 0; s < M; s++){
+		const int R = fft_sbg_radix_stage_radix(SIZE, RADIX, s);
+		for(int g = 0; g < SIZE/R; g++){
+			uint8_t any = 0;
+			for(int i = 0; i < R; i++)
+				any |= live[s*SIZE + g*R + i];
+			for(int k = 0; k < R; k++)
+				live[(s+1)*SIZE + k*(SIZE/R) + g] = any;
+		}
+	}
+
+	for(int b = 0; b < SIZE; b++)
+		read[M*SIZE + b] = (b >= first) && (b <= last);
+	for(int s = M-1; s >= 0; s--){
+		const int R = fft_sbg_radix_stage_radix(SIZE, RADIX, s);
+		for(int g = 0; g < SIZE/R; g++){
+			uint8_t any = 0;
+			for(int k = 0; k < R; k++)
+				any |= read[(s+1)*SIZE + k*(SIZE/R) + g];
+			for(int i = 0; i < R; i++)
+				read[s*SIZE + g*R + i] = any;
+		}
+	}
+
+	int computed = 0;
+	for(unsigned s = 0; s < M; s++){
+		const int R = fft_sbg_radix_stage_radix(SIZE, RADIX, s);
+		for(int c = 0; c < SIZE/W; c++){
+			bool used = false, nonzero = false, copy = true;
+			for(int i = 0; i < W; i++){
+				used |= read[s*SIZE + c*W + i];
+				if(live[s*SIZE + c*W + i]){
+					nonzero = true;
+					copy = copy && (i % R == 0);
+				}
+			}
+			const fft_sbg_radix_packet packet = !used ? FFT_SBG_RADIX_PACKET_SKIP : !nonzero ? FFT_SBG_RADIX_PACKET_ZERO : copy ? FFT_SBG_RADIX_PACKET_COPY : FFT_SBG_RADIX_PACKET_COMPUTE;
+			packets[s*(SIZE/W) + c] = packet;
+			computed += (packet == FFT_SBG_RADIX_PACKET_COMPUTE);
+		}
+	}
+	return computed;
+}
+
+/**
+ * @brief Stage of the fast software engine
+ * 
+ * Packets of W = fft_sbg_radix_fast_width(SIZE) consecutive positions go through the same twiddling and dft as in
+ * sbg_radix_st_core. The stride permutation is applied by the write : output k of butterfly g goes to
+ * position k*(SIZE/RADIX)+g of the next stage.
+ * 
+ * @param x_R Stage input (real)
+ * @param x_I Stage input (imag)
+ * @param gather Read position p from x[gather[p]] instead of x[p] (digit-reverse of the first stage), nullptr if unused
+ * @param z_R Stage output (real)
+ * @param z_I Stage output (imag)
+ * @param tw_stream Twiddle stream of the stage, (SIZE/W) beats of 2*W values
+ * @param packets Packet actions of the stage (fft_sbg_radix_prune_fill), nullptr to compute every packet
+ * @param flt_R Filter spectrum (real) of a fast convolution, in the twiddle format : the outputs are multiplied by it,
+ * scaled by 1/SIZE and written swapped for the inverse transform (see sbg_radix_fft_conv_fast), nullptr if unused
+ * @param flt_I Filter spectrum (imag)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX>
+void sbg_radix_st_core_fast(const DTYPE x_R[SIZE], const DTYPE x_I[SIZE], const int32_t* gather, DTYPE z_R[SIZE], DTYPE z_I[SIZE], const TTYPE* tw_stream, int Q, const uint8_t* packets = nullptr, const TTYPE* flt_R = nullptr, const TTYPE* flt_I = nullptr){
+	constexpr int W = fft_sbg_radix_fast_width(SIZE);
+	DTYPE din_R[W], din_I[W];
+	DTYPE dout_R[W], dout_I[W];
+	DTYPE twiddled_data_R[W], twiddled_data_I[W];
 
-	sbg_radix_buff_fill<DTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(In_R, In_I, buf_R_0, buf_I_0, dig_rev_config);
+	for(int c = 0; c < SIZE/W; c++, tw_stream += 2*W){
+		if((packets != nullptr) && (packets[c] != FFT_SBG_RADIX_PACKET_COMPUTE)){
+			if(packets[c] == FFT_SBG_RADIX_PACKET_SKIP)
+				continue;
+			for(int g = 0; g < W/RADIX; g++){
+				const int p = (gather != nullptr) ? gather[c*W + g*RADIX] : c*W + g*RADIX;
+				din_R[g] = (packets[c] == FFT_SBG_RADIX_PACKET_COPY) ? x_R[p] : DTYPE(0);
+				din_I[g] = (packets[c] == FFT_SBG_RADIX_PACKET_COPY) ? x_I[p] : DTYPE(0);
+			}
+			for(int k = 0; k < RADIX; k++){
+				DTYPE* out_R = z_R + k*(SIZE/RADIX) + c*(W/RADIX);
+				DTYPE* out_I = z_I + k*(SIZE/RADIX) + c*(W/RADIX);
+				for(int g = 0; g < W/RADIX; g++){
+					out_R[g] = din_R[g];
+					out_I[g] = din_I[g];
+				}
+			}
+			continue;
+		}
+
+		const DTYPE* in_R = x_R + c*W;
+		const DTYPE* in_I = x_I + c*W;
+		if(gather != nullptr){
+			for(int i = 0; i < W; i++){
+				din_R[i] = x_R[gather[c*W + i]];
+				din_I[i] = x_I[gather[c*W + i]];
+			}
+			in_R = din_R;
+			in_I = din_I;
+		}
 
-	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R_0, buf_I_0, buf_R_7, buf_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+		fft_sbg_radix_twiddling_stream<DTYPE, TTYPE, ITYPE, RADIX, W>(in_R, in_I, twiddled_data_R, twiddled_data_I, tw_stream, Q);
+		dft<DTYPE, W, RADIX>(twiddled_data_R, twiddled_data_I, dout_R, dout_I);
 
-	sbg_radix_buff_dump<DTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R_7, buf_I_7, Out_R, Out_I, stride_config);
+		if(flt_R != nullptr){
+			for(int k = 0; k < RADIX; k++){
+				const int p = k*(SIZE/RADIX) + c*(W/RADIX);
+				for(int g = 0; g < W/RADIX; g++){
+					DTYPE product_R, product_I;
+					cmult<DTYPE, TTYPE, DTYPE, ITYPE>(dout_R[g*RADIX + k], dout_I[g*RADIX + k], flt_R[p + g], flt_I[p + g], product_I, product_R, Q);
+					z_R[p + g] = util_scale(product_R, ceillog2(SIZE));
+					z_I[p + g] = util_scale(product_I, ceillog2(SIZE));
+				}
+			}
+			continue;
+		}
 
+		for(int k = 0; k < RADIX; k++){
+			DTYPE* out_R = z_R + k*(SIZE/RADIX) + c*(W/RADIX);
+			DTYPE* out_I = z_I + k*(SIZE/RADIX) + c*(W/RADIX);
+			for(int g = 0; g < W/RADIX; g++){
+				out_R[g] = dout_R[g*RADIX + k];
+				out_I[g] = dout_I[g*RADIX + k];
+			}
+		}
+	}
 }
 
+/**
+ * @brief FFT of the fast software engine
+ * 
+ * Constant geometry, out-of-place form of sbg_radix_fft : no buffer banks, switch networks nor beat counters, only
+ * the digit-reverse gather of the first stage and the stride permutation folded in each stage write. Every butterfly
+ * gets the same operands, twiddles and operation order as in the HLS datapath, so the results are bit-identical to
+ * sbg_radix_fft_sw for float and fixed point types. The last stage of a mixed radix plan uses the tail radix.
+ * 
+ * @param tw_stream Twiddle stream built by fft_sbg_radix_tw_stream_fill with SW = fft_sbg_radix_fast_width(SIZE)
+ * @param dig_rev Digit-reverse indices (fft_sbg_radix_dig_rev_index)
+ * @param ctx Per-instance state, its two buffers are used as ping-pong buffers
+ * @param packets Packet masks of a pruned transform (fft_sbg_radix_prune_fill), nullptr for the whole transform.
+ * The bins that are not read are left undefined.
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_fft_fast(const DTYPE In_R[SIZE], const DTYPE In_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], const TTYPE* tw_stream, const int32_t dig_rev[SIZE], int Q, sbg_radix_ctx<DTYPE, SIZE, RADIX, SW>& ctx, const uint8_t* packets = nullptr){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	constexpr int W = fft_sbg_radix_fast_width(SIZE);
+	DTYPE (*buf_R)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_R);
+	DTYPE (*buf_I)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_I);
+
+	const DTYPE* x_R = In_R;
+	const DTYPE* x_I = In_I;
+	for(unsigned s = 0; s+1 < M; s++){
+		sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX>(x_R, x_I, (s == 0) ? dig_rev : nullptr, buf_R[s % 2], buf_I[s % 2], tw_stream + s*(SIZE/W)*2*W, Q, (packets != nullptr) ? packets + s*(SIZE/W) : nullptr);
+		x_R = buf_R[s % 2];
+		x_I = buf_I[s % 2];
+	}
+	sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, fft_sbg_radix_tail_radix(SIZE, RADIX)>(x_R, x_I, (M == 1) ? dig_rev : nullptr, Out_R, Out_I, tw_stream + (M-1)*(SIZE/W)*2*W, Q, (packets != nullptr) ? packets + (M-1)*(SIZE/W) : nullptr);
+}
+
+/**
+ * @brief Circular convolution of a frame with a filter spectrum, fast engine form of sbg_radix_fft_conv
+ * 
+ * The last stage of the forward transform writes the spectrum product (cmult), scaled by 1/SIZE (util_scale) and
+ * swapped, and the first stage of the inverse transform gathers it : the spectrum never leaves the context. The
+ * last stage of the inverse transform writes the result swapped back. The results are bit-identical to
+ * sbg_radix_fft_conv_sw.
+ * 
+ * @param Flt_R Filter spectrum (real), in the twiddle format
+ * @param Flt_I Filter spectrum (imag)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW>
+void sbg_radix_fft_conv_fast(const DTYPE In_R[SIZE], const DTYPE In_I[SIZE], const TTYPE Flt_R[SIZE], const TTYPE Flt_I[SIZE], DTYPE Out_R[SIZE], DTYPE Out_I[SIZE], const TTYPE* tw_stream, const int32_t dig_rev[SIZE], int Q, sbg_radix_ctx<DTYPE, SIZE, RADIX, SW>& ctx){
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+	constexpr int W = fft_sbg_radix_fast_width(SIZE);
+	constexpr int TAIL_RADIX = fft_sbg_radix_tail_radix(SIZE, RADIX);
+	DTYPE (*buf_R)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_R);
+	DTYPE (*buf_I)[SIZE] = reinterpret_cast<DTYPE (*)[SIZE]>(ctx.buf_I);
+
+	const DTYPE* x_R = In_R;
+	const DTYPE* x_I = In_I;
+	for(unsigned s = 0; s+1 < M; s++){
+		sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX>(x_R, x_I, (s == 0) ? dig_rev : nullptr, buf_R[s % 2], buf_I[s % 2], tw_stream + s*(SIZE/W)*2*W, Q);
+		x_R = buf_R[s % 2];
+		x_I = buf_I[s % 2];
+	}
+	sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, TAIL_RADIX>(x_R, x_I, (M == 1) ? dig_rev : nullptr, buf_R[(M-1) % 2], buf_I[(M-1) % 2], tw_stream + (M-1)*(SIZE/W)*2*W, Q, nullptr, Flt_R, Flt_I);
+	x_R = buf_R[(M-1) % 2];
+	x_I = buf_I[(M-1) % 2];
+
+	for(unsigned s = 0; s+1 < M; s++){
+		sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX>(x_R, x_I, (s == 0) ? dig_rev : nullptr, buf_R[(M+s) % 2], buf_I[(M+s) % 2], tw_stream + s*(SIZE/W)*2*W, Q);
+		x_R = buf_R[(M+s) % 2];
+		x_I = buf_I[(M+s) % 2];
+	}
+	sbg_radix_st_core_fast<DTYPE, TTYPE, ITYPE, SIZE, TAIL_RADIX>(x_R, x_I, (M == 1) ? dig_rev : nullptr, Out_I, Out_R, tw_stream + (M-1)*(SIZE/W)*2*W, Q);
+}
+
+#endif // __SYNTHESIS__
+
 /**
  * @brief FFT, using permutations and explicit datapath with axis interfaces
  * 
@@ -543,19 +1083,124 @@ void sbg_radix_fft(DTYPE In_R[SIZE], DTYPE In_I[SIZE], DTYPE Out_R[SIZE], DTYPE
  * @param Tw_R Twiddle factor (real)
  * @param Tw_I Twiddle factor (imag)
  */
-template<class DTYPE, class STYPE, class VTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+template<class DTYPE, class STYPE, class VTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE, bool INVERSE = false, bool SCALE = false>
 void sbg_radix_fft_axis(STYPE &din, STYPE &dout, TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q){
 	#pragma HLS INLINE
+	static_assert(fft_sbg_radix_tail_radix(SIZE, RADIX) == RADIX, "the HLS datapath needs SIZE to be a power of RADIX");
+
+	constexpr const unsigned M = ceillogR(SIZE, RADIX);
+
+	static DTYPE buf_R[M+1][SW][SIZE/SW], buf_I[M+1][SW][SIZE/SW];
+	#pragma HLS ARRAY_PARTITION variable=buf_R complete dim=1
+	#pragma HLS ARRAY_PARTITION variable=buf_I complete dim=1
+
+	sbg_radix_buff_fill_axis<DTYPE, STYPE, VTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, INVERSE>(din, buf_R[0], buf_I[0], dig_rev_config);
+
+	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R, buf_I, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+
+	sbg_radix_buff_dump_axis<DTYPE, STYPE, VTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE, INVERSE, SCALE>(buf_R[M], buf_I[M], dout, stride_config);
+
+}
+
+/**
+ * @brief Polyphase front-end of a channelizer with axis interfaces : D samples in, one frame of SIZE samples out
+ *
+ * The window of the SIZE.P last samples is kept as P rows of SIZE samples and slides by D samples per frame
+ * (D = SIZE critically sampled, D = SIZE/2 2x oversampled). Each branch c sums its P products in one pipelined
+ * iteration, w[c+p.SIZE].H[p][c] with H the reversed prototype, and the frame is written rotated by the number of
+ * samples read so far (mod SIZE), which moves every channel back to the phase of its last sample. The output stream
+ * feeds sbg_radix_fft_axis (see sbg_radix_channelizer_axis).
+ *
+ * @tparam P Taps per branch
+ * @tparam D Input samples per frame
+ * @param In Input stream (real;imag)
+ * @param Out Folded frames (real;imag)
+ * @param H Reversed prototype, H[p][c] = h[SIZE.P-1-c-p.SIZE], in the twiddle format (Q fractional bits)
+ * @param Q Fractional bits of the prototype
+ */
+template<class DTYPE, class STYPE, class VTYPE, class TTYPE, class ITYPE, int SIZE, int P, int D>
+void sbg_radix_polyphase_axis(STYPE &In, STYPE &Out, TTYPE H[P][SIZE], int Q){
+	static_assert((D == SIZE) || (2*D == SIZE), "the channelizer reads SIZE or SIZE/2 samples per frame");
 
-	static DTYPE buf_R_0[SW][SIZE/SW], buf_I_0[SW][SIZE/SW];
-	static DTYPE buf_R_7[SW][SIZE/SW], buf_I_7[SW][SIZE/SW];
+	// ping-pong windows : the sliding reads the previous window while the new one is written
+	static DTYPE line_R[2][P][SIZE], line_I[2][P][SIZE];
+	static bool ping = false;
+	static unsigned rot = 0;
+	DTYPE z_R[SIZE], z_I[SIZE];
+	VTYPE in_vector, out_vector;
+	#pragma HLS ARRAY_PARTITION variable=line_R complete dim=2
+	#pragma HLS ARRAY_PARTITION variable=line_I complete dim=2
+	#pragma HLS ARRAY_PARTITION variable=H complete dim=1
 
-	sbg_radix_buff_fill_axis<DTYPE, STYPE, VTYPE, SIZE, SW, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE>(din, buf_R_0, buf_I_0, dig_rev_config);
+	fold_loop :
+	for(int c = 0; c < SIZE; c++){
+		#pragma HLS PIPELINE
+		DTYPE new_R = 0, new_I = 0;
+		if( c + D >= SIZE ){
+			In.read(in_vector);
+			new_R = (in_vector.data).range(31, 0);
+			new_I = (in_vector.data).range(63, 32);
+		}
 
-	sbg_radix_stages<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R_0, buf_I_0, buf_R_7, buf_I_7, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
+		// the P products are summed on the width of the multiplier outputs
+		ITYPE acc_R = 0, acc_I = 0;
+		branch_loop :
+		for(int p = 0; p < P; p++){
+			// w'[c+p.SIZE] = w[c+D+p.SIZE], the D last samples of the window coming from the input stream
+			DTYPE w_R, w_I;
+			if( c + D < SIZE ){
+				w_R = line_R[ping][p][c + D];
+				w_I = line_I[ping][p][c + D];
+			}else if( p + 1 < P ){
+				w_R = line_R[ping][p + 1][c + D - SIZE];
+				w_I = line_I[ping][p + 1][c + D - SIZE];
+			}else{
+				w_R = new_R;
+				w_I = new_I;
+			}
+			line_R[!ping][p][c] = w_R;
+			line_I[!ping][p][c] = w_I;
+			acc_R = acc_R + mult<DTYPE, TTYPE, ITYPE>(w_R, H[p][c], Q);
+			acc_I = acc_I + mult<DTYPE, TTYPE, ITYPE>(w_I, H[p][c], Q);
+		}
+		z_R[c] = acc_R;
+		z_I[c] = acc_I;
+	}
+	ping = !ping;
+	rot  = (rot + D) % SIZE;
+
+	rotate_loop :
+	for(int q = 0; q < SIZE; q++){
+		#pragma HLS PIPELINE
+		const int c = (q + SIZE - rot) % SIZE;
+		out_vector.data = (z_I[c], z_R[c]);
+		out_vector.keep = -1;
+		out_vector.strb = -1;
+		out_vector.last = (q >= (SIZE-1)) ? 1 : 0;
+		Out.write(out_vector);
+	}
+}
+
+/**
+ * @brief Polyphase channelizer with axis interfaces : the polyphase front-end and the FFT run as a dataflow, one
+ * frame of SIZE channels every D input samples
+ *
+ * @tparam P Taps per branch
+ * @tparam D Input samples per frame : SIZE (critically sampled) or SIZE/2 (2x oversampled)
+ * @param din Input stream (real;imag)
+ * @param dout Channels of each frame, in natural order (real;imag)
+ * @param H Reversed prototype (see sbg_radix_polyphase_axis)
+ * @param Q_H Fractional bits of the prototype
+ */
+template<class DTYPE, class STYPE, class VTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE, int P, int D>
+void sbg_radix_channelizer_axis(STYPE &din, STYPE &dout, TTYPE H[P][SIZE], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, int Q_H, int Q){
+	#pragma HLS DATAFLOW
+	static STYPE frames;
+	#pragma HLS STREAM variable=frames depth=SIZE
 
-	sbg_radix_buff_dump_axis<DTYPE, STYPE, VTYPE, SIZE, SW, LOG2N, LOG2SW, STRIDE_PERM_SWITCH_NUM_STAGE>(buf_R_7, buf_I_7, dout, stride_config);
+	sbg_radix_polyphase_axis<DTYPE, STYPE, VTYPE, TTYPE, ITYPE, SIZE, P, D>(din, frames, H, Q_H);
 
+	sbg_radix_fft_axis<DTYPE, STYPE, VTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, LOG2N, LOG2SW, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(frames, dout, Tw_R, Tw_I, dig_rev_config, stride_config, Q);
 }
 
 #endif // FFT_SBG_RADIX_HPP_
@@ -14,6 +14,7 @@
 
 #include "ap_int.h"
 #include "fft_sbg_radix.hpp"
+#include "../../../roms/roms.h"
 
 #ifndef NFFT
 #define NFFT 		4096
@@ -31,6 +32,14 @@
 #define GROUP_SIZE 2
 #endif
 
+#ifndef FFT_INVERSE
+#define FFT_INVERSE false
+#endif
+
+#ifndef FFT_SCALE
+#define FFT_SCALE false
+#endif
+
 #ifndef CORE_RADIX
 #define CORE_RADIX 8
 #endif
@@ -47,33 +56,8 @@
 #define SIN_LUT SIN_LUT_N4096_Q2_18 //SIN_LUT_HELPER(NFFT, 2, TW_WIDTH-2)
 #endif
 
-#ifndef DIGREV_CONFIG
-#warning "Using default DIGREV_CONFIG"
-#define DIGREV_CONFIG_CONCAT(N, SW, R) DIG_REV_PERM_CONFIG_N##N##_SW##SW##_R##R
-#define DIGREV_CONFIG_HELPER(N, SW, R) DIGREV_CONFIG_CONCAT(N, SW, R)
-#define DIGREV_CONFIG DIGREV_CONFIG_HELPER(NFFT, STREAMING_WIDTH, CORE_RADIX)
-#endif
-
-#ifndef DIGREV_NUMSTAGE
-#warning "Using default DIGREV_NUMSTAGE"
-#define DIGREV_NUMSTAGE_CONCAT(N, SW, R) DIGIT_REV_NUM_STAGE_N##N##_SW##SW##_R##R
-#define DIGREV_NUMSTAGE_HELPER(N, SW, R) DIGREV_NUMSTAGE_CONCAT(N, SW, R)
-#define DIGREV_NUMSTAGE DIGREV_NUMSTAGE_HELPER(NFFT, STREAMING_WIDTH, CORE_RADIX)
-#endif
-
-#ifndef STRIDE_CONFIG
-#warning "Using default STRIDE_CONFIG"
-#define STRIDE_CONFIG_CONCAT(N, SW, R) STRIDE_PERM_CONFIG_N##N##_SW##SW##_R##R
-#define STRIDE_CONFIG_HELPER(N, SW, R) STRIDE_CONFIG_CONCAT(N, SW, R)
-#define STRIDE_CONFIG STRIDE_CONFIG_HELPER(NFFT, STREAMING_WIDTH, CORE_RADIX)
-#endif
-
-#ifndef STRIDE_NUMSTAGE
-#warning "Using default STRIDE_NUMSTAGE"
-#define STRIDE_NUMSTAGE_CONCAT(N, SW, R) STRIDE_PERM_SWITCH_NUM_STAGE_N##N##_SW##SW##_R##R
-#define STRIDE_NUMSTAGE_HELPER(N, SW, R) STRIDE_NUMSTAGE_CONCAT(N, SW, R)
-#define STRIDE_NUMSTAGE STRIDE_NUMSTAGE_HELPER(NFFT, STREAMING_WIDTH, CORE_RADIX)
-#endif
+typedef dig_rev_perm<NFFT, STREAMING_WIDTH, CORE_RADIX> DIGREV_PERM;
+typedef stride_perm<NFFT, STREAMING_WIDTH, CORE_RADIX> STRIDE_PERM;
 
 #define D_WIDTH		22
 #define I_WIDTH		TW_WIDTH+D_WIDTH
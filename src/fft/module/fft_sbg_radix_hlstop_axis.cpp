@@ -26,9 +26,9 @@ void fft_axis(IO_TYPE &din, IO_TYPE &dout){
 
 	static TW_TYPE t_sin_fixed[NFFT] = SIN_LUT;
 
-	static perm_config<DIGREV_NUMSTAGE, STREAMING_WIDTH, ceillog2(NFFT), ceillog2(STREAMING_WIDTH)> digrev_config = {DIGREV_CONFIG};
+	static DIGREV_PERM::config_t digrev_config = DIGREV_PERM::config();
 
-	static perm_config<STRIDE_NUMSTAGE, STREAMING_WIDTH, ceillog2(NFFT), ceillog2(STREAMING_WIDTH)> stride_config = {STRIDE_CONFIG};
+	static STRIDE_PERM::config_t stride_config = STRIDE_PERM::config();
 
-	sbg_radix_fft_axis<SAMPLE_TYPE, IO_TYPE, VECTOR_TYPE, TW_TYPE, INT_TYPE,  NFFT, CORE_RADIX, STREAMING_WIDTH, GROUP_SIZE, ceillog2(NFFT), ceillog2(STREAMING_WIDTH), DIGREV_NUMSTAGE , STRIDE_NUMSTAGE >(din, dout, t_cos_fixed, t_sin_fixed, digrev_config, stride_config, TW_WIDTH-3);
+	sbg_radix_fft_axis<SAMPLE_TYPE, IO_TYPE, VECTOR_TYPE, TW_TYPE, INT_TYPE,  NFFT, CORE_RADIX, STREAMING_WIDTH, GROUP_SIZE, ceillog2(NFFT), ceillog2(STREAMING_WIDTH), DIGREV_PERM::NUM_STAGE, STRIDE_PERM::NUM_STAGE, FFT_INVERSE, FFT_SCALE >(din, dout, t_cos_fixed, t_sin_fixed, digrev_config, stride_config, TW_WIDTH-3);
 }
@@ -12,10 +12,12 @@
 #ifndef FFT_SBG_RADIX_UTILS_HPP_
 #define FFT_SBG_RADIX_UTILS_HPP_
 
-#include "../../common/spiral_utils/spiral_utils.hpp"
+#include "../../common/spiral_utils/perm_config_gen.hpp"
 
 #include "ap_int.h"
 
+#include <type_traits>
+
 #pragma GCC diagnostic push 
 #pragma GCC diagnostic ignored "-Wshift-count-overflow"
 
@@ -35,9 +37,10 @@
  * @param Tw_R Twiddle factor table (real)
  * @param Tw_I Twiddle factor table (imag)
  * @param Q Twiddle factor quantization
+ * @param tw_counter Index of the SW data packet in the stage
  */
 template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GSTART>
-void fft_sbg_radix_twiddling(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], int STAGE, int Q){
+void fft_sbg_radix_twiddling(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW], TTYPE Tw_R[SIZE], TTYPE Tw_I[SIZE], int STAGE, int Q, int tw_counter){
 	#pragma HLS INTERFACE ap_ctrl_none port=return
 	#pragma HLS INLINE off
 	#pragma HLS PIPELINE
@@ -50,9 +53,6 @@ void fft_sbg_radix_twiddling(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE Out_R[SW], DT
 	ITYPE temp_R;
 	ITYPE temp_I;
 
-	static int tw_counter = (SIZE/SW)-1;
-	tw_counter = (tw_counter == ((SIZE/SW)-1)) ? 0 : tw_counter + 1;
-
 	for(int bfi = 0; bfi < SW/RADIX; bfi++){
 		int divider = ((M-STAGE) * log2R);
 		int shiftedbfi = ((tw_counter << divider) & BFMASK);
@@ -82,6 +82,235 @@ void fft_sbg_radix_twiddling(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE Out_R[SW], DT
 	}
 }
 
+#ifndef __SYNTHESIS__
+
+/**
+ * @brief Radix of the last stage : SIZE / RADIX^(M-1), RADIX itself when SIZE is a power of RADIX
+ * 
+ * Plans whose size is not a power of their radix run M-1 radix RADIX stages followed by a smaller radix tail stage,
+ * e.g. 2048 points as three radix 8 stages and a radix 4 one.
+ */
+constexpr int fft_sbg_radix_tail_radix(int SIZE, int RADIX){
+	return SIZE >> ((ceillogR(SIZE, RADIX) - 1) * ceillog2(RADIX));
+}
+
+/**
+ * @brief Radix of a stage (see fft_sbg_radix_tail_radix)
+ */
+constexpr int fft_sbg_radix_stage_radix(int SIZE, int RADIX, unsigned i_stage){
+	return (i_stage + 1 == ceillogR(SIZE, RADIX)) ? fft_sbg_radix_tail_radix(SIZE, RADIX) : RADIX;
+}
+
+/**
+ * @brief Length of the twiddle stream of a FFT : one beat of SW complex twiddles per SW data packet and per stage
+ */
+constexpr unsigned fft_sbg_radix_tw_stream_length(int SIZE, int RADIX, int SW){
+	return ceillogR(SIZE, RADIX) * (SIZE/SW) * 2 * SW;
+}
+
+/**
+ * @brief Builds the twiddle stream consumed by fft_sbg_radix_twiddling_stream
+ * 
+ * The addresses computed by fft_sbg_radix_twiddling for every stage, data packet and lane are resolved once. The stream is
+ * stage-major, then packet-major : beat (STAGE, j) holds the SW real parts then the SW opposite imaginary parts of the
+ * twiddles of packet j, so that a packet reads one contiguous 2*SW block. Lanes using W0 are not multiplied and hold 0.
+ * 
+ * @tparam TTYPE twiddle factory type
+ * @tparam SIZE fft size
+ * @tparam RADIX Butterfly radix
+ * @tparam SW streaming width
+ * @param Tw_R Twiddle factor table (real)
+ * @param Tw_I Twiddle factor table (imag)
+ * @param tw_stream Twiddle stream, fft_sbg_radix_tw_stream_length(SIZE, RADIX, SW) values
+ */
+template<class TTYPE, int SIZE, int RADIX, int SW>
+void fft_sbg_radix_tw_stream_fill(const TTYPE Tw_R[SIZE], const TTYPE Tw_I[SIZE], TTYPE tw_stream[]){
+	const unsigned M = ceillogR(SIZE, RADIX);
+	constexpr const unsigned log2N = ceillog2(SIZE);
+	constexpr const unsigned log2R = ceillog2(RADIX);
+
+	TTYPE* beat = tw_stream;
+	for(unsigned i_stage = 0; i_stage < M; i_stage++){
+		// (M-STAGE)*log2R of fft_sbg_radix_twiddling, the tail stage of a mixed radix plan using the last divider (0)
+		const int r = fft_sbg_radix_stage_radix(SIZE, RADIX, i_stage);
+		const int divider = (i_stage+1 < M) ? (log2N - (i_stage+1) * log2R) : 0;
+		for(int tw_counter = 0; tw_counter < SIZE/SW; tw_counter++, beat += 2*SW){
+			for(int bfi = 0; bfi < SW/r; bfi++){
+				beat[r*bfi]      = 0;
+				beat[SW + r*bfi] = 0;
+				for(int twi = 1; twi < r; twi++){
+					const int twid_index = ((((tw_counter*SW/r)+bfi) >> divider)*twi) << divider;
+					beat[r*bfi + twi]      = Tw_R[twid_index];
+					beat[SW + r*bfi + twi] = -Tw_I[twid_index];
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Computes twiddle mults for a SW data, twiddles being read from a twiddle stream
+ * 
+ * Same products as fft_sbg_radix_twiddling, without the address computation.
+ * 
+ * @tparam DTYPE data type
+ * @tparam TTYPE twiddle factory type
+ * @tparam RADIX Butterfly radix
+ * @tparam SW streaming width
+ * @param In_R Input data packet (real)
+ * @param In_I Input data packet (imag)
+ * @param Out_R Output data packet (real)
+ * @param Out_I Output data packet (imag)
+ * @param tw Beat of the twiddle stream (SW real parts, then SW opposite imaginary parts)
+ * @param Q Twiddle factor quantization
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int RADIX, int SW>
+void fft_sbg_radix_twiddling_stream(const DTYPE In_R[SW], const DTYPE In_I[SW], DTYPE Out_R[SW], DTYPE Out_I[SW], const TTYPE tw[2*SW], int Q){
+	// Q only matters to the fixed point products (float plans have Q = 0)
+	if(twiddle_simd<DTYPE, TTYPE, SW, RADIX>::enabled && ((Q >= 1) || std::is_floating_point<DTYPE>::value)){
+		twiddle_simd<DTYPE, TTYPE, SW, RADIX>::run(In_R, In_I, Out_R, Out_I, tw, Q);
+		return;
+	}
+
+	ITYPE temp_R;
+	ITYPE temp_I;
+
+	for(int i = 0; i < SW; i++){
+		if(i % RADIX == 0){
+			Out_R[i] = In_R[i]; // First twid always with W0
+			Out_I[i] = In_I[i];
+		}else{
+			temp_R = mult_sub<DTYPE, TTYPE, ITYPE>(In_R[i], tw[i], In_I[i], tw[SW+i], Q);
+			temp_I = mult_add<DTYPE, TTYPE, ITYPE>(In_I[i], tw[i], In_R[i], tw[SW+i], Q);
+			Out_R[i] = temp_R;
+			Out_I[i] = temp_I;
+		}
+	}
+}
+
+/**
+ * @brief Packet width of the fast software engine (sbg_radix_fft_fast), independent of the streaming width
+ */
+constexpr int fft_sbg_radix_fast_width(int SIZE){
+	return (SIZE < 32) ? SIZE : 32;
+}
+
+/**
+ * @brief Digit-reverse (base RADIX) indices of a SIZE points vector, as done by the digit-reverse permutation
+ * 
+ * The digits of p are taken low to high with the stage radices (the last one being the tail radix of a mixed radix
+ * plan) and weighted high to low in the input sample index.
+ * 
+ * @param index index[p] is the input sample read at position p of the first stage
+ */
+template<int SIZE, int RADIX>
+void fft_sbg_radix_dig_rev_index(int32_t index[SIZE]){
+	const unsigned M = ceillogR(SIZE, RADIX);
+	for(int p = 0; p < SIZE; p++){
+		int32_t digits = p, reversed = 0;
+		for(unsigned k = 0; k < M; k++){
+			const int r = fft_sbg_radix_stage_radix(SIZE, RADIX, k);
+			reversed = reversed * r + (digits % r);
+			digits  /= r;
+		}
+		index[p] = reversed;
+	}
+}
+
+/**
+ * @brief Permutation configuration compiled into per-packet index tables
+ * 
+ * The stage buffers of the software model are packet-major : the value stored at address addr of bank lane is at
+ * flat index addr*SW + lane, so that the SW values of the read address j are contiguous.
+ * 
+ * @tparam SIZE fft size
+ * @tparam SW streaming width
+ */
+template<int SIZE, int SW>
+struct fft_sbg_radix_perm_table {
+	int32_t r_lane[SIZE/SW][SW];  /**< Lane i of read packet j takes lane r_lane[j][i] of the buffer row j */
+	int32_t w_index[SIZE/SW][SW]; /**< Lane i of written packet j goes to the flat index w_index[j][i] */
+};
+
+/**
+ * @brief Compiles a permutation configuration into index tables
+ * 
+ * Lane numbers go through the HLS switch networks and address generators once per packet, so that the tables
+ * describe exactly what fft_sbg_radix_st_dr_buf_read and fft_sbg_radix_stride_buf_write (or digrev_buf_write) do.
+ * 
+ * @param config Permutation configuration
+ * @param table Compiled tables
+ */
+template<int SIZE, int SW, int LOG2N, int LOG2SW, int NUM_STAGE>
+void fft_sbg_radix_perm_table_compile(perm_config<NUM_STAGE, SW, LOG2N, LOG2SW> config, fft_sbg_radix_perm_table<SIZE, SW>& table){
+	for(int j = 0; j < SIZE/SW; j++){
+		const ap_uint<LOG2N-LOG2SW> bits = j;
+
+		int lane_R[SW], lane_I[SW], src_R[SW], src_I[SW];
+		for(int i = 0; i < SW; i++){
+			lane_R[i] = i;
+			lane_I[i] = i;
+		}
+		switch_network_read<int, NUM_STAGE, SW, LOG2N, LOG2SW>(lane_R, lane_I, src_R, src_I, bits, config.r_switch_connection_idx, config.r_switch_control_bit);
+
+		ap_uint<LOG2N-LOG2SW+1> w_addr[SW];
+		buf_write_addr_generation<SW, LOG2N, LOG2SW>(bits, false, config.w_addr_bit_seq, w_addr);
+		content_addr<int, LOG2N, LOG2SW> pre_switch[SW], post_switch[SW];
+		combine_addr_data<int, SW, LOG2N, LOG2SW>(pre_switch, w_addr, lane_R, lane_I);
+		switch_network_write<content_addr<int, LOG2N, LOG2SW>, NUM_STAGE, SW, LOG2N, LOG2SW>(pre_switch, post_switch, bits, config.init_perm_idx, config.w_switch_connection_idx, config.w_switch_control_bit);
+
+		for(int i = 0; i < SW; i++){
+			table.r_lane[j][i] = src_R[i];
+			table.w_index[j][post_switch[i].data_R] = (int32_t) post_switch[i].addr * SW + i;
+		}
+	}
+}
+
+/**
+ * @brief Reads the packet j of a packet-major buffer : one shuffle of the row j
+ * 
+ * @param buf_R Packet-major buffer (real)
+ * @param buf_I Packet-major buffer (imag)
+ * @param Out_R Output data packet (real)
+ * @param Out_I Output data packet (imag)
+ * @param table Compiled permutation tables
+ * @param j Packet index
+ */
+template<class DTYPE, int SIZE, int SW>
+void fft_sbg_radix_table_read(const DTYPE buf_R[SIZE], const DTYPE buf_I[SIZE], DTYPE Out_R[SW], DTYPE Out_I[SW], const fft_sbg_radix_perm_table<SIZE, SW>& table, int j){
+	const int32_t* lane = table.r_lane[j];
+	if(perm_simd<DTYPE, SW>::enabled){
+		perm_simd<DTYPE, SW>::run(buf_R + j*SW, lane, Out_R);
+		perm_simd<DTYPE, SW>::run(buf_I + j*SW, lane, Out_I);
+		return;
+	}
+	for(int i = 0; i < SW; i++){
+		Out_R[i] = buf_R[j*SW + lane[i]];
+		Out_I[i] = buf_I[j*SW + lane[i]];
+	}
+}
+
+/**
+ * @brief Writes the packet j to a packet-major buffer : one scatter
+ * 
+ * @param In_R Input data packet (real)
+ * @param In_I Input data packet (imag)
+ * @param buf_R Packet-major buffer (real)
+ * @param buf_I Packet-major buffer (imag)
+ * @param table Compiled permutation tables
+ * @param j Packet index
+ */
+template<class DTYPE, int SIZE, int SW>
+void fft_sbg_radix_table_write(const DTYPE In_R[SW], const DTYPE In_I[SW], DTYPE buf_R[SIZE], DTYPE buf_I[SIZE], const fft_sbg_radix_perm_table<SIZE, SW>& table, int j){
+	const int32_t* index = table.w_index[j];
+	for(int i = 0; i < SW; i++){
+		buf_R[index[i]] = In_R[i];
+		buf_I[index[i]] = In_I[i];
+	}
+}
+
+#endif // __SYNTHESIS__
+
 #pragma GCC diagnostic pop
 
 template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW>
@@ -103,13 +332,7 @@ void fft_sbg_radix_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW],
 }
 
 template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE>
-void fft_sbg_radix_digrev_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool wt_offset, perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config){
-	static ap_uint<LOG2N-LOG2SW> j = (SIZE/SW)-1;
-	if(j == (SIZE/SW)-1)
-		j = 0;
-	else
-		j++;
-
+void fft_sbg_radix_digrev_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool wt_offset, perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, ap_uint<LOG2N-LOG2SW> j){
 	ap_uint<LOG2N-LOG2SW+1> w_addr[SW];
 	buf_write_addr_generation<SW, LOG2N, LOG2SW>(j, wt_offset, dig_rev_config.w_addr_bit_seq, w_addr);
 
@@ -121,13 +344,7 @@ void fft_sbg_radix_digrev_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[
 }
 
 template<class DTYPE, int SIZE, int SW, int GSTART, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE>
-void fft_sbg_radix_stride_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool wt_offset, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config){
-	static ap_uint<LOG2N-LOG2SW> j = (SIZE/SW)-1;
-	if(j == (SIZE/SW)-1)
-		j = 0;
-	else
-		j++;
-
+void fft_sbg_radix_stride_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool wt_offset, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, ap_uint<LOG2N-LOG2SW> j){
 	ap_uint<LOG2N-LOG2SW+1> w_addr[SW];
 	buf_write_addr_generation<SW, LOG2N, LOG2SW>(j, wt_offset, stride_config.w_addr_bit_seq, w_addr);
 
@@ -139,13 +356,7 @@ void fft_sbg_radix_stride_buf_write(DTYPE In_R[SW], DTYPE In_I[SW], DTYPE buf_R[
 }
 
 template<class DTYPE, int SIZE, int SW, int GSTART, int LOG2N, int LOG2SW, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
-void fft_sbg_radix_st_dr_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool rd_offset, bool first_stage, DTYPE Out_R[SW], DTYPE Out_I[SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config){
-	static ap_uint<LOG2N-LOG2SW> j = (SIZE/SW)-1;
-	if(j == (SIZE/SW)-1)
-		j = 0;
-	else
-		j++;
-
+void fft_sbg_radix_st_dr_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool rd_offset, bool first_stage, DTYPE Out_R[SW], DTYPE Out_I[SW], perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW> dig_rev_config, perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, ap_uint<LOG2N-LOG2SW> j){
 	ap_uint<LOG2N-LOG2SW+1> r_addr[SW], r_addr_post_switch[SW];
 	buf_read_addr_generation<SW, LOG2N, LOG2SW>(j, rd_offset, r_addr);
 
@@ -161,13 +372,7 @@ void fft_sbg_radix_st_dr_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE
 }
 
 template<class DTYPE, int SIZE, int SW, int LOG2N, int LOG2SW, int STRIDE_PERM_SWITCH_NUM_STAGE>
-void fft_sbg_radix_final_stride_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool rd_offset, DTYPE Out_R[SW], DTYPE Out_I[SW], perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config){
-	static ap_uint<LOG2N-LOG2SW> j = (SIZE/SW)-1;
-	if(j == (SIZE/SW)-1)
-		j = 0;
-	else
-		j++;
-
+void fft_sbg_radix_final_stride_buf_read(DTYPE buf_R[SW][SIZE/SW], DTYPE buf_I[SW][SIZE/SW], bool rd_offset, DTYPE Out_R[SW], DTYPE Out_I[SW], perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride_config, ap_uint<LOG2N-LOG2SW> j){
 	ap_uint<LOG2N-LOG2SW+1> r_addr[SW], r_addr_post_switch[SW];
 	buf_read_addr_generation<SW, LOG2N, LOG2SW>(j, rd_offset, r_addr);
 
@@ -9,497 +9,482 @@
  * 
  */
 
+#include <algorithm>
+#include <vector>
 #include "lib_fft_sbg_radix.hpp"
 
-static bool rom_loaded = false;
-static float* t_cos;
-static float* t_sin;
-static int64_t* t_cos_fixed;
-static int64_t* t_sin_fixed;
+static sbg_rom rom = { 0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+
+// Plan kept across lib_sbg_radix_fft calls, so that its converted twiddles are reused
+static sbg_plan* cached_plan = nullptr;
+
+// Same for the lengths that are not a power of two, with their cached chirp spectrum
+static sbg_bplan* cached_bplan = nullptr;
+
+// Same for the power of two lengths above SBG_PLAN_MAX_SIZE, with their twiddles and worker threads
+static sbg_fplan* cached_fplan = nullptr;
+
+// Same for the two-dimensional frames
+static sbg_plan2d* cached_plan2d = nullptr;
+
+// Same for the real input transforms, the paired mode running on a SIZE points complex plan of its own
+static sbg_rplan* cached_rplan = nullptr;
+static sbg_plan*  cached_pair_plan = nullptr;
+
+// Workers of the batches, kept across calls so that the threads are only created when their number changes
+static sbg_pool* cached_pool = nullptr;
+static int32_t   cached_pool_threads = 0;
+
+const sbg_rom& lib_fft_sbg_radix_roms(){
+    return rom;
+}
+
+/**
+ * @brief Cached pool of THREADS workers (the hardware concurrency when <= 0)
+ */
+static sbg_pool& lib_sbg_radix_pool(const int32_t THREADS){
+    if( (cached_pool == nullptr) || (cached_pool_threads != THREADS) ){
+        delete cached_pool;
+        cached_pool = new sbg_pool(THREADS);
+        cached_pool_threads = THREADS;
+    }
+    return *cached_pool;
+}
+
+/**
+ * @brief Lines of a ROM file, the blank ones (e.g. a trailing newline) left out
+ */
+static std::vector<std::string> lib_fft_sbg_radix_read_rom(const std::string& name){
+    std::ifstream file( name );
+    if( file.is_open() == false ){
+        printf("(EE) Probleme à l'ouverture du fichier (%s)\n", name.c_str());
+        exit( EXIT_FAILURE );
+    }
+    std::vector<std::string> lines;
+    std::string tmp;
+    while( std::getline(file, tmp) ){
+        if( tmp.find_first_not_of(" \t\r") != std::string::npos ){
+            lines.push_back( tmp );
+        }
+    }
+    file.close();
+    return lines;
+}
 
 void lib_fft_sbg_radix_load_fft_roms(std::string cfile, const int32_t SIZE){
-    t_cos = new float[SIZE];
-    t_sin = new float[SIZE];
-    t_cos_fixed = new int64_t[SIZE];
-    t_sin_fixed = new int64_t[SIZE];
+    sbg_plan_destroy( cached_plan );
+    cached_plan = nullptr;
+    sbg_bplan_destroy( cached_bplan );
+    cached_bplan = nullptr;
+    sbg_fplan_destroy( cached_fplan );
+    cached_fplan = nullptr;
+    sbg_plan2d_destroy( cached_plan2d );
+    cached_plan2d = nullptr;
+    sbg_rplan_destroy( cached_rplan );
+    cached_rplan = nullptr;
+    sbg_plan_destroy( cached_pair_plan );
+    cached_pair_plan = nullptr;
+
+    delete[] rom.cos;
+    delete[] rom.sin;
+    delete[] rom.cos_double;
+    delete[] rom.sin_double;
+    delete[] rom.cos_fixed;
+    delete[] rom.sin_fixed;
+    rom.SIZE = 0;
 
     std::string file_cos = cfile + "/cos.txt";
     std::string file_sin = cfile + "/sin.txt";
 
+    const std::vector<std::string> l_cos = lib_fft_sbg_radix_read_rom( file_cos );
+    const std::vector<std::string> l_sin = lib_fft_sbg_radix_read_rom( file_sin );
+
+    // The ROM takes the length of its files : a larger ROM serves the SIZE points plans through a stride (see sbg_rom)
+    const int32_t ROM_SIZE = (int32_t) l_cos.size();
+    if( (ROM_SIZE < SIZE) || (l_sin.size() != l_cos.size()) ){
+        std::cout << "(EE) Error in lib_fft_sbg_radix_load_fft_roms function, the ROM files (" << file_cos << ", " << file_sin << ") hold " << l_cos.size() << " and " << l_sin.size() << " twiddles, " << SIZE << " are needed !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    float*   t_cos = new float[ROM_SIZE];
+    float*   t_sin = new float[ROM_SIZE];
+    double*  t_cos_double = new double[ROM_SIZE];
+    double*  t_sin_double = new double[ROM_SIZE];
+    int64_t* t_cos_fixed = new int64_t[ROM_SIZE];
+    int64_t* t_sin_fixed = new int64_t[ROM_SIZE];
+
     //
     // CHARGEMENT DE LA TABLE DES COSINUS
     //
 
-    std::ifstream cosfile( file_cos );
-    if( cosfile.is_open() == false ){
-        printf("(EE) Probleme à l'ouverture du fichier (%s)\n", file_cos.c_str());
-        exit( EXIT_FAILURE );
-    }
-    for(int i = 0; i < SIZE; i += 1)
+    for(int i = 0; i < ROM_SIZE; i += 1)
     {
-        std::string tmp;
-        std::getline(cosfile, tmp);
-        t_cos[i] = std::stof( tmp );
-        t_cos_fixed[i] = std::stoi( tmp );
+        t_cos[i] = std::stof( l_cos[i] );
+        t_cos_double[i] = std::stod( l_cos[i] );
+        t_cos_fixed[i] = std::stoi( l_cos[i] );
     }
-    cosfile.close();
 
     //
     // CHARGEMENT DE LA TABLE DES SINUS
     //
 
-    std::ifstream sinfile( file_sin );
-    if( sinfile.is_open() == false ){
-        printf("(EE) Probleme à l'ouverture du fichier (%s)\n", file_sin.c_str());
-        exit( EXIT_FAILURE );
-    }
-    for(int i = 0; i < SIZE; i += 1)
+    for(int i = 0; i < ROM_SIZE; i += 1)
     {
-        std::string tmp;
-        std::getline(sinfile, tmp);
-        t_sin[i] = std::stof( tmp );
-        t_sin_fixed[i] = std::stoi( tmp );
+        t_sin[i] = std::stof( l_sin[i] );
+        t_sin_double[i] = std::stod( l_sin[i] );
+        t_sin_fixed[i] = std::stoi( l_sin[i] );
         
         t_sin[i] = t_sin[i]; // On inverse la table du sinus car dans l'algo on va de -2pi à 0
                               // Et dans le fichier on fait l'inverse !
         t_sin_fixed[i] = t_sin_fixed[i];
     }
-    sinfile.close();
 
-    rom_loaded = true;
+    rom.SIZE      = ROM_SIZE;
+    rom.cos       = t_cos;
+    rom.sin       = t_sin;
+    rom.cos_double = t_cos_double;
+    rom.sin_double = t_sin_double;
+    rom.cos_fixed = t_cos_fixed;
+    rom.sin_fixed = t_sin_fixed;
 }
 
-void lib_sbg_radix_fft(DataVector& data, Parameters& p){
+sbg_engine sbg_engine_from_name(const std::string& name){
+    if( name == "fast"     ) return SBG_ENGINE_FAST;
+    if( name == "model"    ) return SBG_ENGINE_MODEL;
+    if( name == "validate" ) return SBG_ENGINE_VALIDATE;
+    std::cout << "(EE) Error in sbg_engine_from_name function, unknown engine [" << name << "] (fast, model or validate) !" << std::endl;
+    exit( EXIT_FAILURE );
+}
+
+/**
+ * @brief Numeric configuration of the plans from the command line quantifications
+ */
+static sbg_types lib_sbg_radix_types(Parameters& p){
     const std::string q_input    = p.toString("q_input");
     const std::string q_internal = p.toString("q_internal");
     const std::string q_rom      = p.toString("q_rom");
 
+    const bool float_input = (q_input == "double") || (q_input == "float");
+    const bool float_rom   = (q_rom   == "double") || (q_rom   == "float");
+
+    sbg_types types;
+    if( (q_internal=="float") && (q_rom=="float") )
+    {
+        types.internal = SBG_DTYPE_FLOAT;
+        types.q_input  = float_input ? 0 : p.toInt("q_input");
+        types.q_rom    = 0;
+    }else if( (q_internal=="double") && float_rom )
+    {
+        types.internal = SBG_DTYPE_DOUBLE;
+        types.q_input  = float_input ? 0 : p.toInt("q_input");
+        types.q_rom    = 0;
+    }else if( (!float_input) && (!float_rom) )
+    {
+        // fast_fixed is bit-identical to ap_int, the latter is kept as reference
+        types.internal = (p.exist("fixed_model") && (p.toString("fixed_model") == "ap-int")) ? SBG_DTYPE_FIXED : SBG_DTYPE_FAST_FIXED;
+        types.q_input  = p.toInt("q_input");
+        types.q_rom    = p.toInt("q_rom");
+    }
+    else{
+        std::cout << "(EE) Error in lib_fft_perm function, the FFT implementation does not exist !" << std::endl;
+        std::cout << "(EE) q_input    =  [" << q_input    << "]" << std::endl;
+        std::cout << "(EE) q_internal =  [" << q_internal << "]" << std::endl;
+        std::cout << "(EE) q_rom      =  [" << q_rom      << "]" << std::endl;
+        std::cout << "(EE) This configuration is not supported by the FFT implementation model =  [" << p.toString("model") << "]." << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    return types;
+}
+
+int32_t lib_sbg_radix_rom_size(const int32_t SIZE){
+    if( (SIZE & (SIZE - 1)) != 0 )
+        return sbg_bplan_conv_size(SIZE);
+    if( SIZE > SBG_PLAN_MAX_SIZE ){
+        int32_t N1, N2;
+        sbg_fplan_split(SIZE, N1, N2);
+        return N1;
+    }
+    return SIZE;
+}
+
+void lib_sbg_radix_fft(DataVector& data, Parameters& p){
     const int32_t SIZE = p.toInt("FFT_SIZE");
     const int32_t SW = p.toInt("SW");
     const int32_t RADIX = p.toInt("RADIX");
-    // const int32_t RADIX = 4;
-    // const int32_t SW = 8;
     constexpr const int GS = 2;
 
-    if(!rom_loaded){
-        std::cout << "(EE) Kastner Lut ROM not loaded !" << std::endl;
+    const sbg_types types = lib_sbg_radix_types(p);
+
+    const int32_t FRAMES = data.I.size() / SIZE;
+    if( FRAMES * SIZE != (int32_t) data.I.size() ){
+        std::cout << "(EE) Error in lib_sbg_radix_fft function, the signal length (" << data.I.size() << ") is not a multiple of the FFT size (" << SIZE << ") !" << std::endl;
         exit( EXIT_FAILURE );
     }
 
-    if( (q_internal=="float") && (q_rom=="float") )
-    {   
-        float* inI = new float[SIZE];
-        float* inQ = new float[SIZE];
-        float* outI = new float[SIZE];
-        float* outQ = new float[SIZE];
-
-        if((q_input == "double") || (q_input == "float")){
-            for(int i = 0; i < SIZE; i++){
-                inI[i] = data.I[i];
-                inQ[i] = data.Q[i];//samples_in_Q.read();
-            }
-        }
-        else{
-            const uint8_t Q_in = p.toInt("q_input");
-            for(int i = 0; i < SIZE; i++){
-                inI[i] = std::round(data.I[i]*(1 << (Q_in-1)));
-                inQ[i] = std::round(data.Q[i]*(1 << (Q_in-1)));//samples_in_Q.read();
-            }
-        }
+    const std::string inverse = p.exist("inverse") ? p.toString("inverse") : "none";
+    const sbg_direction direction = (inverse == "none") ? SBG_FORWARD : SBG_INVERSE;
 
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW2_R2  , 2, ceillog2(  16), ceillog2(2)> dig_rev_config_R2_N16_SW2   = { DIG_REV_PERM_CONFIG_N16_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW2_R2  , 2, ceillog2(  32), ceillog2(2)> dig_rev_config_R2_N32_SW2   = { DIG_REV_PERM_CONFIG_N32_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW2_R2  , 2, ceillog2(  64), ceillog2(2)> dig_rev_config_R2_N64_SW2   = { DIG_REV_PERM_CONFIG_N64_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW2_R2 , 2, ceillog2( 128), ceillog2(2)> dig_rev_config_R2_N128_SW2  = { DIG_REV_PERM_CONFIG_N128_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW2_R2 , 2, ceillog2( 256), ceillog2(2)> dig_rev_config_R2_N256_SW2  = { DIG_REV_PERM_CONFIG_N256_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW2_R2 , 2, ceillog2( 512), ceillog2(2)> dig_rev_config_R2_N512_SW2  = { DIG_REV_PERM_CONFIG_N512_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW2_R2, 2, ceillog2(1024), ceillog2(2)> dig_rev_config_R2_N1024_SW2 = { DIG_REV_PERM_CONFIG_N1024_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW2_R2, 2, ceillog2(2048), ceillog2(2)> dig_rev_config_R2_N2048_SW2 = { DIG_REV_PERM_CONFIG_N2048_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW2_R2, 2, ceillog2(4096), ceillog2(2)> dig_rev_config_R2_N4096_SW2 = { DIG_REV_PERM_CONFIG_N4096_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW4_R2  , 4, ceillog2(  16), ceillog2(4)> dig_rev_config_R2_N16_SW4   = { DIG_REV_PERM_CONFIG_N16_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW4_R2  , 4, ceillog2(  32), ceillog2(4)> dig_rev_config_R2_N32_SW4   = { DIG_REV_PERM_CONFIG_N32_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW4_R2  , 4, ceillog2(  64), ceillog2(4)> dig_rev_config_R2_N64_SW4   = { DIG_REV_PERM_CONFIG_N64_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW4_R2 , 4, ceillog2( 128), ceillog2(4)> dig_rev_config_R2_N128_SW4  = { DIG_REV_PERM_CONFIG_N128_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW4_R2 , 4, ceillog2( 256), ceillog2(4)> dig_rev_config_R2_N256_SW4  = { DIG_REV_PERM_CONFIG_N256_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW4_R2 , 4, ceillog2( 512), ceillog2(4)> dig_rev_config_R2_N512_SW4  = { DIG_REV_PERM_CONFIG_N512_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW4_R2, 4, ceillog2(1024), ceillog2(4)> dig_rev_config_R2_N1024_SW4 = { DIG_REV_PERM_CONFIG_N1024_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW4_R2, 4, ceillog2(2048), ceillog2(4)> dig_rev_config_R2_N2048_SW4 = { DIG_REV_PERM_CONFIG_N2048_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW4_R2, 4, ceillog2(4096), ceillog2(4)> dig_rev_config_R2_N4096_SW4 = { DIG_REV_PERM_CONFIG_N4096_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW8_R2  , 8, ceillog2(  16), ceillog2(8)> dig_rev_config_R2_N16_SW8   = { DIG_REV_PERM_CONFIG_N16_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW8_R2  , 8, ceillog2(  32), ceillog2(8)> dig_rev_config_R2_N32_SW8   = { DIG_REV_PERM_CONFIG_N32_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R2  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R2_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW8_R2 , 8, ceillog2( 128), ceillog2(8)> dig_rev_config_R2_N128_SW8  = { DIG_REV_PERM_CONFIG_N128_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW8_R2 , 8, ceillog2( 256), ceillog2(8)> dig_rev_config_R2_N256_SW8  = { DIG_REV_PERM_CONFIG_N256_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW8_R2 , 8, ceillog2( 512), ceillog2(8)> dig_rev_config_R2_N512_SW8  = { DIG_REV_PERM_CONFIG_N512_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW8_R2, 8, ceillog2(1024), ceillog2(8)> dig_rev_config_R2_N1024_SW8 = { DIG_REV_PERM_CONFIG_N1024_SW8_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW8_R2, 8, ceillog2(2048), ceillog2(8)> dig_rev_config_R2_N2048_SW8 = { DIG_REV_PERM_CONFIG_N2048_SW8_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R2, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R2_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R2     };
-
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW4_R4  , 4, ceillog2(  16), ceillog2(4)> dig_rev_config_R4_N16_SW4   = { DIG_REV_PERM_CONFIG_N16_SW4_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW4_R4  , 4, ceillog2(  64), ceillog2(4)> dig_rev_config_R4_N64_SW4   = { DIG_REV_PERM_CONFIG_N64_SW4_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW4_R4 , 4, ceillog2( 256), ceillog2(4)> dig_rev_config_R4_N256_SW4  = { DIG_REV_PERM_CONFIG_N256_SW4_R4      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW4_R4, 4, ceillog2(1024), ceillog2(4)> dig_rev_config_R4_N1024_SW4 = { DIG_REV_PERM_CONFIG_N1024_SW4_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW4_R4, 4, ceillog2(4096), ceillog2(4)> dig_rev_config_R4_N4096_SW4 = { DIG_REV_PERM_CONFIG_N4096_SW4_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW8_R4  , 8, ceillog2(  16), ceillog2(8)> dig_rev_config_R4_N16_SW8   = { DIG_REV_PERM_CONFIG_N16_SW8_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R4  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R4_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW8_R4 , 8, ceillog2( 256), ceillog2(8)> dig_rev_config_R4_N256_SW8  = { DIG_REV_PERM_CONFIG_N256_SW8_R4      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW8_R4, 8, ceillog2(1024), ceillog2(8)> dig_rev_config_R4_N1024_SW8 = { DIG_REV_PERM_CONFIG_N1024_SW8_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R4, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R4_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R4     };
-
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R8  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R8_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R8       };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW8_R8 , 8, ceillog2( 512), ceillog2(8)> dig_rev_config_R8_N512_SW8  = { DIG_REV_PERM_CONFIG_N512_SW8_R8      };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R8, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R8_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R8     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW2_R2  , 2, ceillog2(  16), ceillog2(2)> stride_config_R2_N16_SW2   = { STRIDE_PERM_CONFIG_N16_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW2_R2  , 2, ceillog2(  32), ceillog2(2)> stride_config_R2_N32_SW2   = { STRIDE_PERM_CONFIG_N32_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW2_R2  , 2, ceillog2(  64), ceillog2(2)> stride_config_R2_N64_SW2   = { STRIDE_PERM_CONFIG_N64_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW2_R2 , 2, ceillog2( 128), ceillog2(2)> stride_config_R2_N128_SW2  = { STRIDE_PERM_CONFIG_N128_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW2_R2 , 2, ceillog2( 256), ceillog2(2)> stride_config_R2_N256_SW2  = { STRIDE_PERM_CONFIG_N256_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW2_R2 , 2, ceillog2( 512), ceillog2(2)> stride_config_R2_N512_SW2  = { STRIDE_PERM_CONFIG_N512_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW2_R2, 2, ceillog2(1024), ceillog2(2)> stride_config_R2_N1024_SW2 = { STRIDE_PERM_CONFIG_N1024_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW2_R2, 2, ceillog2(2048), ceillog2(2)> stride_config_R2_N2048_SW2 = { STRIDE_PERM_CONFIG_N2048_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW2_R2, 2, ceillog2(4096), ceillog2(2)> stride_config_R2_N4096_SW2 = { STRIDE_PERM_CONFIG_N4096_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R2  , 4, ceillog2(  16), ceillog2(4)> stride_config_R2_N16_SW4   = { STRIDE_PERM_CONFIG_N16_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW4_R2  , 4, ceillog2(  32), ceillog2(4)> stride_config_R2_N32_SW4   = { STRIDE_PERM_CONFIG_N32_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R2  , 4, ceillog2(  64), ceillog2(4)> stride_config_R2_N64_SW4   = { STRIDE_PERM_CONFIG_N64_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW4_R2 , 4, ceillog2( 128), ceillog2(4)> stride_config_R2_N128_SW4  = { STRIDE_PERM_CONFIG_N128_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R2 , 4, ceillog2( 256), ceillog2(4)> stride_config_R2_N256_SW4  = { STRIDE_PERM_CONFIG_N256_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW4_R2 , 4, ceillog2( 512), ceillog2(4)> stride_config_R2_N512_SW4  = { STRIDE_PERM_CONFIG_N512_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R2, 4, ceillog2(1024), ceillog2(4)> stride_config_R2_N1024_SW4 = { STRIDE_PERM_CONFIG_N1024_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW4_R2, 4, ceillog2(2048), ceillog2(4)> stride_config_R2_N2048_SW4 = { STRIDE_PERM_CONFIG_N2048_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R2, 4, ceillog2(4096), ceillog2(4)> stride_config_R2_N4096_SW4 = { STRIDE_PERM_CONFIG_N4096_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R2  , 8, ceillog2(  16), ceillog2(8)> stride_config_R2_N16_SW8   = { STRIDE_PERM_CONFIG_N16_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW8_R2  , 8, ceillog2(  32), ceillog2(8)> stride_config_R2_N32_SW8   = { STRIDE_PERM_CONFIG_N32_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R2  , 8, ceillog2(  64), ceillog2(8)> stride_config_R2_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW8_R2 , 8, ceillog2( 128), ceillog2(8)> stride_config_R2_N128_SW8  = { STRIDE_PERM_CONFIG_N128_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R2 , 8, ceillog2( 256), ceillog2(8)> stride_config_R2_N256_SW8  = { STRIDE_PERM_CONFIG_N256_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R2 , 8, ceillog2( 512), ceillog2(8)> stride_config_R2_N512_SW8  = { STRIDE_PERM_CONFIG_N512_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R2, 8, ceillog2(1024), ceillog2(8)> stride_config_R2_N1024_SW8 = { STRIDE_PERM_CONFIG_N1024_SW8_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW8_R2, 8, ceillog2(2048), ceillog2(8)> stride_config_R2_N2048_SW8 = { STRIDE_PERM_CONFIG_N2048_SW8_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R2, 8, ceillog2(4096), ceillog2(8)> stride_config_R2_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R2     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R4  , 4, ceillog2(  16), ceillog2(4)> stride_config_R4_N16_SW4   = { STRIDE_PERM_CONFIG_N16_SW4_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R4  , 4, ceillog2(  64), ceillog2(4)> stride_config_R4_N64_SW4   = { STRIDE_PERM_CONFIG_N64_SW4_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R4 , 4, ceillog2( 256), ceillog2(4)> stride_config_R4_N256_SW4  = { STRIDE_PERM_CONFIG_N256_SW4_R4      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R4, 4, ceillog2(1024), ceillog2(4)> stride_config_R4_N1024_SW4 = { STRIDE_PERM_CONFIG_N1024_SW4_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R4, 4, ceillog2(4096), ceillog2(4)> stride_config_R4_N4096_SW4 = { STRIDE_PERM_CONFIG_N4096_SW4_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R4  , 8, ceillog2(  16), ceillog2(8)> stride_config_R4_N16_SW8   = { STRIDE_PERM_CONFIG_N16_SW8_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R4  , 8, ceillog2(  64), ceillog2(8)> stride_config_R4_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R4 , 8, ceillog2( 256), ceillog2(8)> stride_config_R4_N256_SW8  = { STRIDE_PERM_CONFIG_N256_SW8_R4      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R4, 8, ceillog2(1024), ceillog2(8)> stride_config_R4_N1024_SW8 = { STRIDE_PERM_CONFIG_N1024_SW8_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R4, 8, ceillog2(4096), ceillog2(8)> stride_config_R4_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R4     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R8  , 8, ceillog2(  64), ceillog2(8)> stride_config_R8_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R8       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R8 , 8, ceillog2( 512), ceillog2(8)> stride_config_R8_N512_SW8  = { STRIDE_PERM_CONFIG_N512_SW8_R8      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R8, 8, ceillog2(4096), ceillog2(8)> stride_config_R8_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R8     };
-        
-        if(RADIX == 2){
-            if(SW == 2){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<float, float, float,   16, 2, 2, GS, ceillog2(  16), ceillog2(2), DIGIT_REV_NUM_STAGE_N16_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW2_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N16_SW2  , stride_config_R2_N16_SW2  , 0); break;
-                    case   32: sbg_radix_fft<float, float, float,   32, 2, 2, GS, ceillog2(  32), ceillog2(2), DIGIT_REV_NUM_STAGE_N32_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW2_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N32_SW2  , stride_config_R2_N32_SW2  , 0); break;
-                    case   64: sbg_radix_fft<float, float, float,   64, 2, 2, GS, ceillog2(  64), ceillog2(2), DIGIT_REV_NUM_STAGE_N64_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW2_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N64_SW2  , stride_config_R2_N64_SW2  , 0); break;
-                    case  128: sbg_radix_fft<float, float, float,  128, 2, 2, GS, ceillog2( 128), ceillog2(2), DIGIT_REV_NUM_STAGE_N128_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW2_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N128_SW2 , stride_config_R2_N128_SW2 , 0); break;
-                    case  256: sbg_radix_fft<float, float, float,  256, 2, 2, GS, ceillog2( 256), ceillog2(2), DIGIT_REV_NUM_STAGE_N256_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW2_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N256_SW2 , stride_config_R2_N256_SW2 , 0); break;
-                    case  512: sbg_radix_fft<float, float, float,  512, 2, 2, GS, ceillog2( 512), ceillog2(2), DIGIT_REV_NUM_STAGE_N512_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW2_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N512_SW2 , stride_config_R2_N512_SW2 , 0); break;
-                    case 1024: sbg_radix_fft<float, float, float, 1024, 2, 2, GS, ceillog2(1024), ceillog2(2), DIGIT_REV_NUM_STAGE_N1024_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW2_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N1024_SW2, stride_config_R2_N1024_SW2, 0); break;
-                    case 2048: sbg_radix_fft<float, float, float, 2048, 2, 2, GS, ceillog2(2048), ceillog2(2), DIGIT_REV_NUM_STAGE_N2048_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW2_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N2048_SW2, stride_config_R2_N2048_SW2, 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 2, 2, GS, ceillog2(4096), ceillog2(2), DIGIT_REV_NUM_STAGE_N4096_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW2_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N4096_SW2, stride_config_R2_N4096_SW2, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }else if(SW == 4){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<float, float, float,   16, 2, 4, GS, ceillog2(  16), ceillog2(4), DIGIT_REV_NUM_STAGE_N16_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N16_SW4  , stride_config_R2_N16_SW4  , 0); break;
-                    case   32: sbg_radix_fft<float, float, float,   32, 2, 4, GS, ceillog2(  32), ceillog2(4), DIGIT_REV_NUM_STAGE_N32_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW4_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N32_SW4  , stride_config_R2_N32_SW4  , 0); break;
-                    case   64: sbg_radix_fft<float, float, float,   64, 2, 4, GS, ceillog2(  64), ceillog2(4), DIGIT_REV_NUM_STAGE_N64_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N64_SW4  , stride_config_R2_N64_SW4  , 0); break;
-                    case  128: sbg_radix_fft<float, float, float,  128, 2, 4, GS, ceillog2( 128), ceillog2(4), DIGIT_REV_NUM_STAGE_N128_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW4_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N128_SW4 , stride_config_R2_N128_SW4 , 0); break;
-                    case  256: sbg_radix_fft<float, float, float,  256, 2, 4, GS, ceillog2( 256), ceillog2(4), DIGIT_REV_NUM_STAGE_N256_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N256_SW4 , stride_config_R2_N256_SW4 , 0); break;
-                    case  512: sbg_radix_fft<float, float, float,  512, 2, 4, GS, ceillog2( 512), ceillog2(4), DIGIT_REV_NUM_STAGE_N512_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW4_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N512_SW4 , stride_config_R2_N512_SW4 , 0); break;
-                    case 1024: sbg_radix_fft<float, float, float, 1024, 2, 4, GS, ceillog2(1024), ceillog2(4), DIGIT_REV_NUM_STAGE_N1024_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N1024_SW4, stride_config_R2_N1024_SW4, 0); break;
-                    case 2048: sbg_radix_fft<float, float, float, 2048, 2, 4, GS, ceillog2(2048), ceillog2(4), DIGIT_REV_NUM_STAGE_N2048_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW4_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N2048_SW4, stride_config_R2_N2048_SW4, 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 2, 4, GS, ceillog2(4096), ceillog2(4), DIGIT_REV_NUM_STAGE_N4096_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N4096_SW4, stride_config_R2_N4096_SW4, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            } else if(SW == 8){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<float, float, float,   16, 2, 8, GS, ceillog2(  16), ceillog2(8), DIGIT_REV_NUM_STAGE_N16_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N16_SW8  , stride_config_R2_N16_SW8  , 0); break;
-                    case   32: sbg_radix_fft<float, float, float,   32, 2, 8, GS, ceillog2(  32), ceillog2(8), DIGIT_REV_NUM_STAGE_N32_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW8_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N32_SW8  , stride_config_R2_N32_SW8  , 0); break;
-                    case   64: sbg_radix_fft<float, float, float,   64, 2, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R2  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N64_SW8  , stride_config_R2_N64_SW8  , 0); break;
-                    case  128: sbg_radix_fft<float, float, float,  128, 2, 8, GS, ceillog2( 128), ceillog2(8), DIGIT_REV_NUM_STAGE_N128_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW8_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N128_SW8 , stride_config_R2_N128_SW8 , 0); break;
-                    case  256: sbg_radix_fft<float, float, float,  256, 2, 8, GS, ceillog2( 256), ceillog2(8), DIGIT_REV_NUM_STAGE_N256_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N256_SW8 , stride_config_R2_N256_SW8 , 0); break;
-                    case  512: sbg_radix_fft<float, float, float,  512, 2, 8, GS, ceillog2( 512), ceillog2(8), DIGIT_REV_NUM_STAGE_N512_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R2 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N512_SW8 , stride_config_R2_N512_SW8 , 0); break;
-                    case 1024: sbg_radix_fft<float, float, float, 1024, 2, 8, GS, ceillog2(1024), ceillog2(8), DIGIT_REV_NUM_STAGE_N1024_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N1024_SW8, stride_config_R2_N1024_SW8, 0); break;
-                    case 2048: sbg_radix_fft<float, float, float, 2048, 2, 8, GS, ceillog2(2048), ceillog2(8), DIGIT_REV_NUM_STAGE_N2048_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW8_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N2048_SW8, stride_config_R2_N2048_SW8, 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 2, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R2>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R2_N4096_SW8, stride_config_R2_N4096_SW8, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
-        }else if(RADIX == 4){
-            if(SW == 4){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<float, float, float,   16, 4, 4, GS, ceillog2(  16), ceillog2(4), DIGIT_REV_NUM_STAGE_N16_SW4_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R4  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N16_SW4  , stride_config_R4_N16_SW4  , 0); break;
-                    case   64: sbg_radix_fft<float, float, float,   64, 4, 4, GS, ceillog2(  64), ceillog2(4), DIGIT_REV_NUM_STAGE_N64_SW4_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R4  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N64_SW4  , stride_config_R4_N64_SW4  , 0); break;
-                    case  256: sbg_radix_fft<float, float, float,  256, 4, 4, GS, ceillog2( 256), ceillog2(4), DIGIT_REV_NUM_STAGE_N256_SW4_R4 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R4 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N256_SW4 , stride_config_R4_N256_SW4 , 0); break;
-                    case 1024: sbg_radix_fft<float, float, float, 1024, 4, 4, GS, ceillog2(1024), ceillog2(4), DIGIT_REV_NUM_STAGE_N1024_SW4_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R4>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N1024_SW4, stride_config_R4_N1024_SW4, 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 4, 4, GS, ceillog2(4096), ceillog2(4), DIGIT_REV_NUM_STAGE_N4096_SW4_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R4>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N4096_SW4, stride_config_R4_N4096_SW4, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            } else if(SW == 8){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<float, float, float,   16, 4, 8, GS, ceillog2(  16), ceillog2(8), DIGIT_REV_NUM_STAGE_N16_SW8_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R4  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N16_SW8  , stride_config_R4_N16_SW8  , 0); break;
-                    case   64: sbg_radix_fft<float, float, float,   64, 4, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R4  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N64_SW8  , stride_config_R4_N64_SW8  , 0); break;
-                    case  256: sbg_radix_fft<float, float, float,  256, 4, 8, GS, ceillog2( 256), ceillog2(8), DIGIT_REV_NUM_STAGE_N256_SW8_R4 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R4 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N256_SW8 , stride_config_R4_N256_SW8 , 0); break;
-                    case 1024: sbg_radix_fft<float, float, float, 1024, 4, 8, GS, ceillog2(1024), ceillog2(8), DIGIT_REV_NUM_STAGE_N1024_SW8_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R4>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N1024_SW8, stride_config_R4_N1024_SW8, 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 4, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R4>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R4_N4096_SW8, stride_config_R4_N4096_SW8, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
-        }else if(RADIX == 8){
-            if(SW == 8){
-                switch (SIZE) {
-                    case   64: sbg_radix_fft<float, float, float,   64, 8, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R8  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R8  >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R8_N64_SW8  , stride_config_R8_N64_SW8  , 0); break;
-                    case  512: sbg_radix_fft<float, float, float,  512, 8, 8, GS, ceillog2( 512), ceillog2(8), DIGIT_REV_NUM_STAGE_N512_SW8_R8 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R8 >(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R8_N512_SW8 , stride_config_R8_N512_SW8 , 0); break;
-                    case 4096: sbg_radix_fft<float, float, float, 4096, 8, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R8, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R8>(inI, inQ, outI, outQ, t_cos, t_sin, dig_rev_config_R8_N4096_SW8, stride_config_R8_N4096_SW8, 0); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
+    // pruned transform : known zero samples from VALID_INPUTS onward, only the bins BINS_FIRST..BINS_LAST kept
+    const int32_t VALID = p.exist("VALID_INPUTS") ? p.toInt("VALID_INPUTS") : SIZE;
+    const int32_t FIRST = p.exist("BINS_FIRST")   ? p.toInt("BINS_FIRST")   : 0;
+    const int32_t LAST  = p.exist("BINS_LAST")    ? p.toInt("BINS_LAST")    : SIZE-1;
+    const bool pruned = (VALID != SIZE) || (FIRST != 0) || (LAST != SIZE-1);
+    if( pruned && (((SIZE & (SIZE - 1)) != 0) || (SIZE > SBG_PLAN_MAX_SIZE)) ){
+        std::cout << "(EE) Error in lib_sbg_radix_fft function, the pruned transforms need a power of two FFT size up to " << SBG_PLAN_MAX_SIZE << " points !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    if( (SIZE & (SIZE - 1)) != 0 ){
+        // arbitrary length : chirp-z transform on sbg_bplan_conv_size(SIZE) points plans
+        const bool reuse = (cached_bplan != nullptr) && (cached_bplan->SIZE == SIZE) && (cached_bplan->plan->RADIX == RADIX) && (cached_bplan->plan->SW == SW)
+                        && (cached_bplan->plan->types.internal == types.internal) && (cached_bplan->plan->types.q_input == types.q_input) && (cached_bplan->plan->types.q_rom == types.q_rom);
+        if( !reuse ){
+            sbg_bplan_destroy( cached_bplan );
+            cached_bplan = sbg_bplan_create(SIZE, RADIX, SW, GS, types);
         }
-        
-        
-        if((q_input == "double") || (q_input == "float")){
-            for(int i = 0; i < SIZE; i++){
-                data.I[i]=outI[i];
-                data.Q[i]=outQ[i];
-            }
+        sbg_plan_set_engine(cached_bplan->plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+        sbg_bplan_set_direction(cached_bplan, direction, inverse == "scaled");
+        sbg_bplan_execute(cached_bplan, data.I.data(), data.Q.data(), data.I.data(), data.Q.data(), FRAMES);
+        return;
+    }
+
+    if( SIZE > SBG_PLAN_MAX_SIZE ){
+        // very large transform : four-step decomposition on sub plans, the threads work inside each frame
+        const int32_t THREADS = p.exist("THREADS") ? p.toInt("THREADS") : 1;
+        const bool reuse = (cached_fplan != nullptr) && (cached_fplan->SIZE == SIZE) && (cached_fplan->plan_N1->RADIX == RADIX) && (cached_fplan->plan_N1->SW == SW) && (cached_fplan->pool->size() == THREADS)
+                        && (cached_fplan->plan_N1->types.internal == types.internal) && (cached_fplan->plan_N1->types.q_input == types.q_input) && (cached_fplan->plan_N1->types.q_rom == types.q_rom);
+        if( !reuse ){
+            sbg_fplan_destroy( cached_fplan );
+            cached_fplan = sbg_fplan_create(SIZE, RADIX, SW, GS, types, THREADS);
         }
-        else{    
-            const uint8_t Q_in = p.toInt("q_input");
-            for(int i = 0; i < SIZE; i++){
-                data.I[i]=outI[i]/(1<<(Q_in-1));
-                data.Q[i]=outQ[i]/(1<<(Q_in-1));
-            }
+        sbg_fplan_set_engine(cached_fplan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+        sbg_fplan_set_direction(cached_fplan, direction, inverse == "scaled");
+        sbg_fplan_execute(cached_fplan, data.I.data(), data.Q.data(), data.I.data(), data.Q.data(), FRAMES);
+        return;
+    }
+
+    const bool reuse = (cached_plan != nullptr) && (cached_plan->SIZE == SIZE) && (cached_plan->RADIX == RADIX) && (cached_plan->SW == SW) && (cached_plan->GROUP == GS)
+                    && (cached_plan->types.internal == types.internal) && (cached_plan->types.q_input == types.q_input) && (cached_plan->types.q_rom == types.q_rom);
+    if( !reuse ){
+        sbg_plan_destroy( cached_plan );
+        cached_plan = sbg_plan_create(SIZE, RADIX, SW, GS, types);
+    }
+    sbg_plan_set_engine(cached_plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+    sbg_plan_set_direction(cached_plan, direction, inverse == "scaled");
+    sbg_plan_set_pruning(cached_plan, VALID, FIRST, LAST);
+    const sbg_frames frames = {data.I.data(), data.Q.data(), data.I.data(), data.Q.data()};
+    sbg_batch_execute(cached_plan, frames, FRAMES, lib_sbg_radix_pool(p.exist("THREADS") ? p.toInt("THREADS") : 1));
+
+    if( (FIRST != 0) || (LAST != SIZE-1) ){
+        // only the bins of the band are kept, frame after frame
+        const int32_t BINS = LAST - FIRST + 1;
+        for(int f = 0; f < FRAMES; f++){
+            std::copy(data.I.begin() + f*SIZE + FIRST, data.I.begin() + f*SIZE + LAST + 1, data.I.begin() + f*BINS);
+            std::copy(data.Q.begin() + f*SIZE + FIRST, data.Q.begin() + f*SIZE + LAST + 1, data.Q.begin() + f*BINS);
         }
+        data.I.resize(FRAMES * BINS);
+        data.Q.resize(FRAMES * BINS);
+    }
+}
 
-        delete[] inI;
-        delete[] inQ;
-        delete[] outI;
-        delete[] outQ;
-    }else if((!((q_input == "double") || (q_input == "float"))) && (!((q_rom == "float") || (q_rom == "double"))))
-    {
-        const uint8_t Q_twiddle = p.toInt("q_rom"); // Q = QN.D with N = 2
-        const uint8_t Q_in = p.toInt("q_input")-2;
-        constexpr const int GS = 2;
-        
-        typedef ap_int<32> dType;
-        typedef ap_int<32> tType;
-        typedef ap_int<64> iType;
-        
-        dType* dinI = new dType[SIZE];
-        dType* dinQ = new dType[SIZE];
+void lib_sbg_radix_fft2d(DataVector& data, Parameters& p){
+    const int32_t SIZE = p.toInt("FFT_SIZE");
+    const int32_t ROWS = p.toInt("ROWS");
+    const int32_t COLS = SIZE / ROWS;
+    const int32_t SW = p.toInt("SW");
+    const int32_t RADIX = p.toInt("RADIX");
+    const int32_t THREADS = p.exist("THREADS") ? p.toInt("THREADS") : 1;
+    constexpr const int GS = 2;
 
-        dType* outI = new dType[SIZE];
-        dType* outQ = new dType[SIZE];
+    const sbg_types types = lib_sbg_radix_types(p);
 
+    const int32_t FRAMES = data.I.size() / SIZE;
+    if( (COLS * ROWS != SIZE) || (FRAMES * SIZE != (int32_t) data.I.size()) ){
+        std::cout << "(EE) Error in lib_sbg_radix_fft2d function, the signal length (" << data.I.size() << ") is not a multiple of " << ROWS << " rows of " << COLS << " samples !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
 
-        tType* tc = new tType[SIZE];
-        tType* ts = new tType[SIZE];
+    const std::string inverse = p.exist("inverse") ? p.toString("inverse") : "none";
+    const sbg_direction direction = (inverse == "none") ? SBG_FORWARD : SBG_INVERSE;
 
-        for(int i = 0; i < SIZE; i++){
-            dinI[i] = data.I.data()[i] * (((dType) 1) << Q_in);
-            dinQ[i] = data.Q.data()[i] * (((dType) 1) << Q_in);
-        }
+    const bool reuse = (cached_plan2d != nullptr) && (cached_plan2d->ROWS == ROWS) && (cached_plan2d->COLS == COLS) && (cached_plan2d->plan_row->RADIX == RADIX) && (cached_plan2d->plan_row->SW == SW) && (cached_plan2d->pool->size() == THREADS)
+                    && (cached_plan2d->plan_row->types.internal == types.internal) && (cached_plan2d->plan_row->types.q_input == types.q_input) && (cached_plan2d->plan_row->types.q_rom == types.q_rom);
+    if( !reuse ){
+        sbg_plan2d_destroy( cached_plan2d );
+        cached_plan2d = sbg_plan2d_create(ROWS, COLS, RADIX, SW, GS, types, THREADS);
+    }
+    sbg_plan2d_set_engine(cached_plan2d, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+    sbg_plan2d_set_direction(cached_plan2d, direction, inverse == "scaled");
+    sbg_plan2d_execute(cached_plan2d, data.I.data(), data.Q.data(), data.I.data(), data.Q.data(), FRAMES);
+}
 
-        for(int i = 0; i < SIZE; i++){
-            tc[i] = t_cos_fixed[i];
-            ts[i] = t_sin_fixed[i];
-        }
+void lib_sbg_radix_stft(DataVector& data, Parameters& p){
+    const int32_t SIZE = p.toInt("FFT_SIZE");
+    const int32_t HOP = p.toInt("STFT_HOP");
+    const int32_t SW = p.toInt("SW");
+    const int32_t RADIX = p.toInt("RADIX");
+    const sbg_window window = sbg_window_from_name(p.exist("window") ? p.toString("window") : "hann");
+    const float beta = p.exist("kaiser_beta") ? p.toFloat("kaiser_beta") : 8.6f;
+    constexpr const int GS = 2;
 
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW2_R2  , 2, ceillog2(  16), ceillog2(2)> dig_rev_config_R2_N16_SW2   = { DIG_REV_PERM_CONFIG_N16_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW2_R2  , 2, ceillog2(  32), ceillog2(2)> dig_rev_config_R2_N32_SW2   = { DIG_REV_PERM_CONFIG_N32_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW2_R2  , 2, ceillog2(  64), ceillog2(2)> dig_rev_config_R2_N64_SW2   = { DIG_REV_PERM_CONFIG_N64_SW2_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW2_R2 , 2, ceillog2( 128), ceillog2(2)> dig_rev_config_R2_N128_SW2  = { DIG_REV_PERM_CONFIG_N128_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW2_R2 , 2, ceillog2( 256), ceillog2(2)> dig_rev_config_R2_N256_SW2  = { DIG_REV_PERM_CONFIG_N256_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW2_R2 , 2, ceillog2( 512), ceillog2(2)> dig_rev_config_R2_N512_SW2  = { DIG_REV_PERM_CONFIG_N512_SW2_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW2_R2, 2, ceillog2(1024), ceillog2(2)> dig_rev_config_R2_N1024_SW2 = { DIG_REV_PERM_CONFIG_N1024_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW2_R2, 2, ceillog2(2048), ceillog2(2)> dig_rev_config_R2_N2048_SW2 = { DIG_REV_PERM_CONFIG_N2048_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW2_R2, 2, ceillog2(4096), ceillog2(2)> dig_rev_config_R2_N4096_SW2 = { DIG_REV_PERM_CONFIG_N4096_SW2_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW4_R2  , 4, ceillog2(  16), ceillog2(4)> dig_rev_config_R2_N16_SW4   = { DIG_REV_PERM_CONFIG_N16_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW4_R2  , 4, ceillog2(  32), ceillog2(4)> dig_rev_config_R2_N32_SW4   = { DIG_REV_PERM_CONFIG_N32_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW4_R2  , 4, ceillog2(  64), ceillog2(4)> dig_rev_config_R2_N64_SW4   = { DIG_REV_PERM_CONFIG_N64_SW4_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW4_R2 , 4, ceillog2( 128), ceillog2(4)> dig_rev_config_R2_N128_SW4  = { DIG_REV_PERM_CONFIG_N128_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW4_R2 , 4, ceillog2( 256), ceillog2(4)> dig_rev_config_R2_N256_SW4  = { DIG_REV_PERM_CONFIG_N256_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW4_R2 , 4, ceillog2( 512), ceillog2(4)> dig_rev_config_R2_N512_SW4  = { DIG_REV_PERM_CONFIG_N512_SW4_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW4_R2, 4, ceillog2(1024), ceillog2(4)> dig_rev_config_R2_N1024_SW4 = { DIG_REV_PERM_CONFIG_N1024_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW4_R2, 4, ceillog2(2048), ceillog2(4)> dig_rev_config_R2_N2048_SW4 = { DIG_REV_PERM_CONFIG_N2048_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW4_R2, 4, ceillog2(4096), ceillog2(4)> dig_rev_config_R2_N4096_SW4 = { DIG_REV_PERM_CONFIG_N4096_SW4_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW8_R2  , 8, ceillog2(  16), ceillog2(8)> dig_rev_config_R2_N16_SW8   = { DIG_REV_PERM_CONFIG_N16_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N32_SW8_R2  , 8, ceillog2(  32), ceillog2(8)> dig_rev_config_R2_N32_SW8   = { DIG_REV_PERM_CONFIG_N32_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R2  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R2_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R2       };
-        perm_config<DIGIT_REV_NUM_STAGE_N128_SW8_R2 , 8, ceillog2( 128), ceillog2(8)> dig_rev_config_R2_N128_SW8  = { DIG_REV_PERM_CONFIG_N128_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW8_R2 , 8, ceillog2( 256), ceillog2(8)> dig_rev_config_R2_N256_SW8  = { DIG_REV_PERM_CONFIG_N256_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW8_R2 , 8, ceillog2( 512), ceillog2(8)> dig_rev_config_R2_N512_SW8  = { DIG_REV_PERM_CONFIG_N512_SW8_R2      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW8_R2, 8, ceillog2(1024), ceillog2(8)> dig_rev_config_R2_N1024_SW8 = { DIG_REV_PERM_CONFIG_N1024_SW8_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N2048_SW8_R2, 8, ceillog2(2048), ceillog2(8)> dig_rev_config_R2_N2048_SW8 = { DIG_REV_PERM_CONFIG_N2048_SW8_R2     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R2, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R2_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R2     };
-
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW4_R4  , 4, ceillog2(  16), ceillog2(4)> dig_rev_config_R4_N16_SW4   = { DIG_REV_PERM_CONFIG_N16_SW4_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW4_R4  , 4, ceillog2(  64), ceillog2(4)> dig_rev_config_R4_N64_SW4   = { DIG_REV_PERM_CONFIG_N64_SW4_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW4_R4 , 4, ceillog2( 256), ceillog2(4)> dig_rev_config_R4_N256_SW4  = { DIG_REV_PERM_CONFIG_N256_SW4_R4      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW4_R4, 4, ceillog2(1024), ceillog2(4)> dig_rev_config_R4_N1024_SW4 = { DIG_REV_PERM_CONFIG_N1024_SW4_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW4_R4, 4, ceillog2(4096), ceillog2(4)> dig_rev_config_R4_N4096_SW4 = { DIG_REV_PERM_CONFIG_N4096_SW4_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N16_SW8_R4  , 8, ceillog2(  16), ceillog2(8)> dig_rev_config_R4_N16_SW8   = { DIG_REV_PERM_CONFIG_N16_SW8_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R4  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R4_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R4       };
-        perm_config<DIGIT_REV_NUM_STAGE_N256_SW8_R4 , 8, ceillog2( 256), ceillog2(8)> dig_rev_config_R4_N256_SW8  = { DIG_REV_PERM_CONFIG_N256_SW8_R4      };
-        perm_config<DIGIT_REV_NUM_STAGE_N1024_SW8_R4, 8, ceillog2(1024), ceillog2(8)> dig_rev_config_R4_N1024_SW8 = { DIG_REV_PERM_CONFIG_N1024_SW8_R4     };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R4, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R4_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R4     };
-
-        perm_config<DIGIT_REV_NUM_STAGE_N64_SW8_R8  , 8, ceillog2(  64), ceillog2(8)> dig_rev_config_R8_N64_SW8   = { DIG_REV_PERM_CONFIG_N64_SW8_R8       };
-        perm_config<DIGIT_REV_NUM_STAGE_N512_SW8_R8 , 8, ceillog2( 512), ceillog2(8)> dig_rev_config_R8_N512_SW8  = { DIG_REV_PERM_CONFIG_N512_SW8_R8      };
-        perm_config<DIGIT_REV_NUM_STAGE_N4096_SW8_R8, 8, ceillog2(4096), ceillog2(8)> dig_rev_config_R8_N4096_SW8 = { DIG_REV_PERM_CONFIG_N4096_SW8_R8     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW2_R2  , 2, ceillog2(  16), ceillog2(2)> stride_config_R2_N16_SW2   = { STRIDE_PERM_CONFIG_N16_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW2_R2  , 2, ceillog2(  32), ceillog2(2)> stride_config_R2_N32_SW2   = { STRIDE_PERM_CONFIG_N32_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW2_R2  , 2, ceillog2(  64), ceillog2(2)> stride_config_R2_N64_SW2   = { STRIDE_PERM_CONFIG_N64_SW2_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW2_R2 , 2, ceillog2( 128), ceillog2(2)> stride_config_R2_N128_SW2  = { STRIDE_PERM_CONFIG_N128_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW2_R2 , 2, ceillog2( 256), ceillog2(2)> stride_config_R2_N256_SW2  = { STRIDE_PERM_CONFIG_N256_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW2_R2 , 2, ceillog2( 512), ceillog2(2)> stride_config_R2_N512_SW2  = { STRIDE_PERM_CONFIG_N512_SW2_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW2_R2, 2, ceillog2(1024), ceillog2(2)> stride_config_R2_N1024_SW2 = { STRIDE_PERM_CONFIG_N1024_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW2_R2, 2, ceillog2(2048), ceillog2(2)> stride_config_R2_N2048_SW2 = { STRIDE_PERM_CONFIG_N2048_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW2_R2, 2, ceillog2(4096), ceillog2(2)> stride_config_R2_N4096_SW2 = { STRIDE_PERM_CONFIG_N4096_SW2_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R2  , 4, ceillog2(  16), ceillog2(4)> stride_config_R2_N16_SW4   = { STRIDE_PERM_CONFIG_N16_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW4_R2  , 4, ceillog2(  32), ceillog2(4)> stride_config_R2_N32_SW4   = { STRIDE_PERM_CONFIG_N32_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R2  , 4, ceillog2(  64), ceillog2(4)> stride_config_R2_N64_SW4   = { STRIDE_PERM_CONFIG_N64_SW4_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW4_R2 , 4, ceillog2( 128), ceillog2(4)> stride_config_R2_N128_SW4  = { STRIDE_PERM_CONFIG_N128_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R2 , 4, ceillog2( 256), ceillog2(4)> stride_config_R2_N256_SW4  = { STRIDE_PERM_CONFIG_N256_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW4_R2 , 4, ceillog2( 512), ceillog2(4)> stride_config_R2_N512_SW4  = { STRIDE_PERM_CONFIG_N512_SW4_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R2, 4, ceillog2(1024), ceillog2(4)> stride_config_R2_N1024_SW4 = { STRIDE_PERM_CONFIG_N1024_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW4_R2, 4, ceillog2(2048), ceillog2(4)> stride_config_R2_N2048_SW4 = { STRIDE_PERM_CONFIG_N2048_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R2, 4, ceillog2(4096), ceillog2(4)> stride_config_R2_N4096_SW4 = { STRIDE_PERM_CONFIG_N4096_SW4_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R2  , 8, ceillog2(  16), ceillog2(8)> stride_config_R2_N16_SW8   = { STRIDE_PERM_CONFIG_N16_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW8_R2  , 8, ceillog2(  32), ceillog2(8)> stride_config_R2_N32_SW8   = { STRIDE_PERM_CONFIG_N32_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R2  , 8, ceillog2(  64), ceillog2(8)> stride_config_R2_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R2       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW8_R2 , 8, ceillog2( 128), ceillog2(8)> stride_config_R2_N128_SW8  = { STRIDE_PERM_CONFIG_N128_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R2 , 8, ceillog2( 256), ceillog2(8)> stride_config_R2_N256_SW8  = { STRIDE_PERM_CONFIG_N256_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R2 , 8, ceillog2( 512), ceillog2(8)> stride_config_R2_N512_SW8  = { STRIDE_PERM_CONFIG_N512_SW8_R2      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R2, 8, ceillog2(1024), ceillog2(8)> stride_config_R2_N1024_SW8 = { STRIDE_PERM_CONFIG_N1024_SW8_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW8_R2, 8, ceillog2(2048), ceillog2(8)> stride_config_R2_N2048_SW8 = { STRIDE_PERM_CONFIG_N2048_SW8_R2     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R2, 8, ceillog2(4096), ceillog2(8)> stride_config_R2_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R2     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R4  , 4, ceillog2(  16), ceillog2(4)> stride_config_R4_N16_SW4   = { STRIDE_PERM_CONFIG_N16_SW4_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R4  , 4, ceillog2(  64), ceillog2(4)> stride_config_R4_N64_SW4   = { STRIDE_PERM_CONFIG_N64_SW4_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R4 , 4, ceillog2( 256), ceillog2(4)> stride_config_R4_N256_SW4  = { STRIDE_PERM_CONFIG_N256_SW4_R4      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R4, 4, ceillog2(1024), ceillog2(4)> stride_config_R4_N1024_SW4 = { STRIDE_PERM_CONFIG_N1024_SW4_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R4, 4, ceillog2(4096), ceillog2(4)> stride_config_R4_N4096_SW4 = { STRIDE_PERM_CONFIG_N4096_SW4_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R4  , 8, ceillog2(  16), ceillog2(8)> stride_config_R4_N16_SW8   = { STRIDE_PERM_CONFIG_N16_SW8_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R4  , 8, ceillog2(  64), ceillog2(8)> stride_config_R4_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R4       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R4 , 8, ceillog2( 256), ceillog2(8)> stride_config_R4_N256_SW8  = { STRIDE_PERM_CONFIG_N256_SW8_R4      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R4, 8, ceillog2(1024), ceillog2(8)> stride_config_R4_N1024_SW8 = { STRIDE_PERM_CONFIG_N1024_SW8_R4     };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R4, 8, ceillog2(4096), ceillog2(8)> stride_config_R4_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R4     };
-
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R8  , 8, ceillog2(  64), ceillog2(8)> stride_config_R8_N64_SW8   = { STRIDE_PERM_CONFIG_N64_SW8_R8       };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R8 , 8, ceillog2( 512), ceillog2(8)> stride_config_R8_N512_SW8  = { STRIDE_PERM_CONFIG_N512_SW8_R8      };
-        perm_config<STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R8, 8, ceillog2(4096), ceillog2(8)> stride_config_R8_N4096_SW8 = { STRIDE_PERM_CONFIG_N4096_SW8_R8     };
-        
-        if(RADIX == 2){
-            if(SW == 2){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<dType, tType, iType,   16, 2, 2, GS, ceillog2(  16), ceillog2(2), DIGIT_REV_NUM_STAGE_N16_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW2_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N16_SW2  , stride_config_R2_N16_SW2  , Q_twiddle-3); break;
-                    case   32: sbg_radix_fft<dType, tType, iType,   32, 2, 2, GS, ceillog2(  32), ceillog2(2), DIGIT_REV_NUM_STAGE_N32_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW2_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N32_SW2  , stride_config_R2_N32_SW2  , Q_twiddle-3); break;
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 2, 2, GS, ceillog2(  64), ceillog2(2), DIGIT_REV_NUM_STAGE_N64_SW2_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW2_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N64_SW2  , stride_config_R2_N64_SW2  , Q_twiddle-3); break;
-                    case  128: sbg_radix_fft<dType, tType, iType,  128, 2, 2, GS, ceillog2( 128), ceillog2(2), DIGIT_REV_NUM_STAGE_N128_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW2_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N128_SW2 , stride_config_R2_N128_SW2 , Q_twiddle-3); break;
-                    case  256: sbg_radix_fft<dType, tType, iType,  256, 2, 2, GS, ceillog2( 256), ceillog2(2), DIGIT_REV_NUM_STAGE_N256_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW2_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N256_SW2 , stride_config_R2_N256_SW2 , Q_twiddle-3); break;
-                    case  512: sbg_radix_fft<dType, tType, iType,  512, 2, 2, GS, ceillog2( 512), ceillog2(2), DIGIT_REV_NUM_STAGE_N512_SW2_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW2_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N512_SW2 , stride_config_R2_N512_SW2 , Q_twiddle-3); break;
-                    case 1024: sbg_radix_fft<dType, tType, iType, 1024, 2, 2, GS, ceillog2(1024), ceillog2(2), DIGIT_REV_NUM_STAGE_N1024_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW2_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N1024_SW2, stride_config_R2_N1024_SW2, Q_twiddle-3); break;
-                    case 2048: sbg_radix_fft<dType, tType, iType, 2048, 2, 2, GS, ceillog2(2048), ceillog2(2), DIGIT_REV_NUM_STAGE_N2048_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW2_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N2048_SW2, stride_config_R2_N2048_SW2, Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 2, 2, GS, ceillog2(4096), ceillog2(2), DIGIT_REV_NUM_STAGE_N4096_SW2_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW2_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N4096_SW2, stride_config_R2_N4096_SW2, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }else if(SW == 4){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<dType, tType, iType,   16, 2, 4, GS, ceillog2(  16), ceillog2(4), DIGIT_REV_NUM_STAGE_N16_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N16_SW4  , stride_config_R2_N16_SW4  , Q_twiddle-3); break;
-                    case   32: sbg_radix_fft<dType, tType, iType,   32, 2, 4, GS, ceillog2(  32), ceillog2(4), DIGIT_REV_NUM_STAGE_N32_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW4_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N32_SW4  , stride_config_R2_N32_SW4  , Q_twiddle-3); break;
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 2, 4, GS, ceillog2(  64), ceillog2(4), DIGIT_REV_NUM_STAGE_N64_SW4_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N64_SW4  , stride_config_R2_N64_SW4  , Q_twiddle-3); break;
-                    case  128: sbg_radix_fft<dType, tType, iType,  128, 2, 4, GS, ceillog2( 128), ceillog2(4), DIGIT_REV_NUM_STAGE_N128_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW4_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N128_SW4 , stride_config_R2_N128_SW4 , Q_twiddle-3); break;
-                    case  256: sbg_radix_fft<dType, tType, iType,  256, 2, 4, GS, ceillog2( 256), ceillog2(4), DIGIT_REV_NUM_STAGE_N256_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N256_SW4 , stride_config_R2_N256_SW4 , Q_twiddle-3); break;
-                    case  512: sbg_radix_fft<dType, tType, iType,  512, 2, 4, GS, ceillog2( 512), ceillog2(4), DIGIT_REV_NUM_STAGE_N512_SW4_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW4_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N512_SW4 , stride_config_R2_N512_SW4 , Q_twiddle-3); break;
-                    case 1024: sbg_radix_fft<dType, tType, iType, 1024, 2, 4, GS, ceillog2(1024), ceillog2(4), DIGIT_REV_NUM_STAGE_N1024_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N1024_SW4, stride_config_R2_N1024_SW4, Q_twiddle-3); break;
-                    case 2048: sbg_radix_fft<dType, tType, iType, 2048, 2, 4, GS, ceillog2(2048), ceillog2(4), DIGIT_REV_NUM_STAGE_N2048_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW4_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N2048_SW4, stride_config_R2_N2048_SW4, Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 2, 4, GS, ceillog2(4096), ceillog2(4), DIGIT_REV_NUM_STAGE_N4096_SW4_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N4096_SW4, stride_config_R2_N4096_SW4, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            } else if(SW == 8){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<dType, tType, iType,   16, 2, 8, GS, ceillog2(  16), ceillog2(8), DIGIT_REV_NUM_STAGE_N16_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N16_SW8  , stride_config_R2_N16_SW8  , Q_twiddle-3); break;
-                    case   32: sbg_radix_fft<dType, tType, iType,   32, 2, 8, GS, ceillog2(  32), ceillog2(8), DIGIT_REV_NUM_STAGE_N32_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N32_SW8_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N32_SW8  , stride_config_R2_N32_SW8  , Q_twiddle-3); break;
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 2, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R2  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R2  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N64_SW8  , stride_config_R2_N64_SW8  , Q_twiddle-3); break;
-                    case  128: sbg_radix_fft<dType, tType, iType,  128, 2, 8, GS, ceillog2( 128), ceillog2(8), DIGIT_REV_NUM_STAGE_N128_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N128_SW8_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N128_SW8 , stride_config_R2_N128_SW8 , Q_twiddle-3); break;
-                    case  256: sbg_radix_fft<dType, tType, iType,  256, 2, 8, GS, ceillog2( 256), ceillog2(8), DIGIT_REV_NUM_STAGE_N256_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N256_SW8 , stride_config_R2_N256_SW8 , Q_twiddle-3); break;
-                    case  512: sbg_radix_fft<dType, tType, iType,  512, 2, 8, GS, ceillog2( 512), ceillog2(8), DIGIT_REV_NUM_STAGE_N512_SW8_R2 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R2 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N512_SW8 , stride_config_R2_N512_SW8 , Q_twiddle-3); break;
-                    case 1024: sbg_radix_fft<dType, tType, iType, 1024, 2, 8, GS, ceillog2(1024), ceillog2(8), DIGIT_REV_NUM_STAGE_N1024_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N1024_SW8, stride_config_R2_N1024_SW8, Q_twiddle-3); break;
-                    case 2048: sbg_radix_fft<dType, tType, iType, 2048, 2, 8, GS, ceillog2(2048), ceillog2(8), DIGIT_REV_NUM_STAGE_N2048_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N2048_SW8_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N2048_SW8, stride_config_R2_N2048_SW8, Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 2, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R2, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R2>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R2_N4096_SW8, stride_config_R2_N4096_SW8, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
-        }else if(RADIX == 4){
-            if(SW == 4){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<dType, tType, iType,   16, 4, 4, GS, ceillog2(  16), ceillog2(4), DIGIT_REV_NUM_STAGE_N16_SW4_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW4_R4  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N16_SW4  , stride_config_R4_N16_SW4  , Q_twiddle-3); break;
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 4, 4, GS, ceillog2(  64), ceillog2(4), DIGIT_REV_NUM_STAGE_N64_SW4_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW4_R4  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N64_SW4  , stride_config_R4_N64_SW4  , Q_twiddle-3); break;
-                    case  256: sbg_radix_fft<dType, tType, iType,  256, 4, 4, GS, ceillog2( 256), ceillog2(4), DIGIT_REV_NUM_STAGE_N256_SW4_R4 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW4_R4 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N256_SW4 , stride_config_R4_N256_SW4 , Q_twiddle-3); break;
-                    case 1024: sbg_radix_fft<dType, tType, iType, 1024, 4, 4, GS, ceillog2(1024), ceillog2(4), DIGIT_REV_NUM_STAGE_N1024_SW4_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW4_R4>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N1024_SW4, stride_config_R4_N1024_SW4, Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 4, 4, GS, ceillog2(4096), ceillog2(4), DIGIT_REV_NUM_STAGE_N4096_SW4_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW4_R4>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N4096_SW4, stride_config_R4_N4096_SW4, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            } else if(SW == 8){
-                switch (SIZE) {
-                    case   16: sbg_radix_fft<dType, tType, iType,   16, 4, 8, GS, ceillog2(  16), ceillog2(8), DIGIT_REV_NUM_STAGE_N16_SW8_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N16_SW8_R4  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N16_SW8  , stride_config_R4_N16_SW8  , Q_twiddle-3); break;
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 4, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R4  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R4  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N64_SW8  , stride_config_R4_N64_SW8  , Q_twiddle-3); break;
-                    case  256: sbg_radix_fft<dType, tType, iType,  256, 4, 8, GS, ceillog2( 256), ceillog2(8), DIGIT_REV_NUM_STAGE_N256_SW8_R4 , STRIDE_PERM_SWITCH_NUM_STAGE_N256_SW8_R4 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N256_SW8 , stride_config_R4_N256_SW8 , Q_twiddle-3); break;
-                    case 1024: sbg_radix_fft<dType, tType, iType, 1024, 4, 8, GS, ceillog2(1024), ceillog2(8), DIGIT_REV_NUM_STAGE_N1024_SW8_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N1024_SW8_R4>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N1024_SW8, stride_config_R4_N1024_SW8, Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 4, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R4, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R4>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R4_N4096_SW8, stride_config_R4_N4096_SW8, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
-        }else if(RADIX == 8){
-            if(SW == 8){
-                switch (SIZE) {
-                    case   64: sbg_radix_fft<dType, tType, iType,   64, 8, 8, GS, ceillog2(  64), ceillog2(8), DIGIT_REV_NUM_STAGE_N64_SW8_R8  , STRIDE_PERM_SWITCH_NUM_STAGE_N64_SW8_R8  >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R8_N64_SW8  , stride_config_R8_N64_SW8  , Q_twiddle-3); break;
-                    case  512: sbg_radix_fft<dType, tType, iType,  512, 8, 8, GS, ceillog2( 512), ceillog2(8), DIGIT_REV_NUM_STAGE_N512_SW8_R8 , STRIDE_PERM_SWITCH_NUM_STAGE_N512_SW8_R8 >(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R8_N512_SW8 , stride_config_R8_N512_SW8 , Q_twiddle-3); break;
-                    case 4096: sbg_radix_fft<dType, tType, iType, 4096, 8, 8, GS, ceillog2(4096), ceillog2(8), DIGIT_REV_NUM_STAGE_N4096_SW8_R8, STRIDE_PERM_SWITCH_NUM_STAGE_N4096_SW8_R8>(dinI, dinQ, outI, outQ, tc, ts, dig_rev_config_R8_N4096_SW8, stride_config_R8_N4096_SW8, Q_twiddle-3); break;
-                    default:
-                        exit( EXIT_FAILURE );
-                }
-            }
-        }
+    const sbg_types types = lib_sbg_radix_types(p);
 
-        for(int i = 0; i < SIZE; i++){
-            data.I.data()[i] = ((double) outI[i]) / (((dType) 1) << Q_in);
-            data.Q.data()[i] = ((double) outQ[i]) / (((dType) 1) << Q_in);
-        }
+    sbg_stft* stft = sbg_stft_create(SIZE, HOP, window, beta, RADIX, SW, GS, types);
+    sbg_plan_set_engine(stft->plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
 
-        delete[] dinI;
-        delete[] dinQ;
-        delete[] outI;
-        delete[] outQ;
+    // the file is pushed by blocks, as a stream would be
+    constexpr const int32_t BLOCK = 4096;
+    const int32_t LENGTH = data.I.size();
+    std::vector<float> out_R((size_t) sbg_stft_max_frames(stft, LENGTH) * SIZE);
+    std::vector<float> out_I(out_R.size());
+    int32_t frames = 0;
+    for(int32_t i = 0; i < LENGTH; i += BLOCK){
+        const int32_t n = std::min(BLOCK, LENGTH - i);
+        frames += sbg_stft_push(stft, data.I.data() + i, data.Q.data() + i, n, out_R.data() + (size_t) frames * SIZE, out_I.data() + (size_t) frames * SIZE);
     }
-    else{
-        std::cout << "(EE) Error in lib_fft_perm function, the FFT implementation does not exist !" << std::endl;
-        std::cout << "(EE) q_input    =  [" << q_input    << "]" << std::endl;
-        std::cout << "(EE) q_internal =  [" << q_internal << "]" << std::endl;
-        std::cout << "(EE) q_rom      =  [" << q_rom      << "]" << std::endl;
-        std::cout << "(EE) This configuration is not supported by the FFT implementation model =  [" << p.toString("model") << "]." << std::endl;
+    sbg_stft_destroy(stft);
+
+    out_R.resize((size_t) frames * SIZE);
+    out_I.resize((size_t) frames * SIZE);
+    data.I = out_R;
+    data.Q = out_I;
+}
+
+void lib_sbg_radix_fir(DataVector& data, const DataVector& taps, Parameters& p){
+    const int32_t SIZE = p.toInt("FFT_SIZE");
+    const int32_t SW = p.toInt("SW");
+    const int32_t RADIX = p.toInt("RADIX");
+    const sbg_conv_method method = sbg_conv_method_from_name(p.exist("conv") ? p.toString("conv") : "save");
+    constexpr const int GS = 2;
+
+    const sbg_types types = lib_sbg_radix_types(p);
+
+    sbg_conv* conv = sbg_conv_create(taps.I.data(), taps.Q.data(), taps.I.size(), SIZE, method, RADIX, SW, GS, types);
+    sbg_plan_set_engine(conv->plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+
+    // the file is pushed by blocks, as a stream would be, then zeros flush the last block
+    constexpr const int32_t CHUNK = 4096;
+    const int32_t LENGTH = data.I.size();
+    std::vector<float> out_R((size_t) LENGTH + 2 * conv->BLOCK);
+    std::vector<float> out_I(out_R.size());
+    const std::vector<float> zeros(CHUNK, 0.0f);
+    int32_t produced = 0;
+    for(int32_t i = 0; i < LENGTH; i += CHUNK){
+        const int32_t n = std::min(CHUNK, LENGTH - i);
+        produced += sbg_conv_push(conv, data.I.data() + i, data.Q.data() + i, n, out_R.data() + produced, out_I.data() + produced);
+    }
+    while( produced < LENGTH )
+        produced += sbg_conv_push(conv, zeros.data(), zeros.data(), std::min(CHUNK, conv->BLOCK), out_R.data() + produced, out_I.data() + produced);
+    sbg_conv_destroy(conv);
+
+    data.I.assign(out_R.begin(), out_R.begin() + LENGTH);
+    data.Q.assign(out_I.begin(), out_I.begin() + LENGTH);
+}
+
+void lib_sbg_radix_channelize(DataVector& data, Parameters& p){
+    const int32_t M = p.toInt("FFT_SIZE");
+    const int32_t P = p.exist("CHAN_TAPS") ? p.toInt("CHAN_TAPS") : 8;
+    const int32_t SW = p.toInt("SW");
+    const int32_t RADIX = p.toInt("RADIX");
+    const sbg_chan_mode mode = sbg_chan_mode_from_name(p.toString("chan"));
+    const float beta = p.exist("kaiser_beta") ? p.toFloat("kaiser_beta") : 8.6f;
+    constexpr const int GS = 2;
+
+    const sbg_types types = lib_sbg_radix_types(p);
+
+    std::vector<float> h((size_t) M * P);
+    sbg_chan_prototype(M, P, beta, h.data());
+    sbg_chan* chan = sbg_chan_create(M, P, mode, h.data(), RADIX, SW, GS, types);
+    sbg_plan_set_engine(chan->plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+
+    // the file is pushed by blocks, as a stream would be, each channel stream being written after the previous one
+    constexpr const int32_t BLOCK = 4096;
+    const int32_t LENGTH = data.I.size();
+    const int64_t stride = sbg_chan_max_frames(chan, LENGTH);
+    std::vector<float> out_R((size_t) stride * M);
+    std::vector<float> out_I(out_R.size());
+    int32_t frames = 0;
+    for(int32_t i = 0; i < LENGTH; i += BLOCK){
+        const int32_t n = std::min(BLOCK, LENGTH - i);
+        frames += sbg_chan_push(chan, data.I.data() + i, data.Q.data() + i, n, out_R.data() + frames, out_I.data() + frames, stride);
+    }
+    sbg_chan_destroy(chan);
+
+    data.I.resize((size_t) frames * M);
+    data.Q.resize((size_t) frames * M);
+    for(int k = 0; k < M; k++){
+        std::copy(out_R.begin() + k * stride, out_R.begin() + k * stride + frames, data.I.begin() + (size_t) k * frames);
+        std::copy(out_I.begin() + k * stride, out_I.begin() + k * stride + frames, data.Q.begin() + (size_t) k * frames);
+    }
+}
+
+void lib_sbg_radix_rfft(DataVector& data, Parameters& p){
+    const int32_t SIZE = p.toInt("FFT_SIZE");
+    const int32_t SW = p.toInt("SW");
+    const int32_t RADIX = p.toInt("RADIX");
+    const int32_t THREADS = p.exist("THREADS") ? p.toInt("THREADS") : 1;
+    const std::string mode = p.toString("real");
+    constexpr const int GS = 2;
+
+    const sbg_types types = lib_sbg_radix_types(p);
+
+    const int32_t FRAMES = data.I.size() / SIZE;
+    if( FRAMES * SIZE != (int32_t) data.I.size() ){
+        std::cout << "(EE) Error in lib_sbg_radix_rfft function, the signal length (" << data.I.size() << ") is not a multiple of the FFT size (" << SIZE << ") !" << std::endl;
         exit( EXIT_FAILURE );
     }
-}
\ No newline at end of file
+
+    // the real input transforms are forward only and keep every input sample and every bin
+    const std::string inverse = p.exist("inverse") ? p.toString("inverse") : "none";
+    if( inverse != "none" ){
+        std::cout << "(EE) Error in lib_sbg_radix_rfft function, the real input modes only compute forward transforms !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    const int32_t VALID = p.exist("VALID_INPUTS") ? p.toInt("VALID_INPUTS") : SIZE;
+    const int32_t FIRST = p.exist("BINS_FIRST")   ? p.toInt("BINS_FIRST")   : 0;
+    const int32_t LAST  = p.exist("BINS_LAST")    ? p.toInt("BINS_LAST")    : SIZE-1;
+    if( (VALID != SIZE) || (FIRST != 0) || (LAST != SIZE-1) ){
+        std::cout << "(EE) Error in lib_sbg_radix_rfft function, the real input modes cannot be pruned !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const int32_t BINS   = SIZE/2 + 1;
+    std::vector<float> out_R, out_I;
+
+    if( mode == "half" ){
+        // real part of the signal only, SIZE/2 points complex transform
+        const bool reuse = (cached_rplan != nullptr) && (cached_rplan->SIZE == SIZE) && (cached_rplan->plan->RADIX == RADIX) && (cached_rplan->plan->SW == SW) && (cached_rplan->plan->GROUP == GS)
+                        && (cached_rplan->plan->types.internal == types.internal) && (cached_rplan->plan->types.q_input == types.q_input) && (cached_rplan->plan->types.q_rom == types.q_rom);
+        if( !reuse ){
+            sbg_rplan_destroy( cached_rplan );
+            cached_rplan = sbg_rplan_create(SIZE, RADIX, SW, GS, types);
+        }
+        sbg_plan_set_engine(cached_rplan->plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+        out_R.resize(FRAMES * BINS);
+        out_I.resize(FRAMES * BINS);
+        sbg_rplan_execute(cached_rplan, data.I.data(), out_R.data(), out_I.data(), FRAMES, &lib_sbg_radix_pool(THREADS));
+    }else if( mode == "pair" ){
+        // real and imaginary parts of the signal are two real signals, each frame gives the bins of the first then the second
+        const bool reuse = (cached_pair_plan != nullptr) && (cached_pair_plan->SIZE == SIZE) && (cached_pair_plan->RADIX == RADIX) && (cached_pair_plan->SW == SW) && (cached_pair_plan->GROUP == GS)
+                        && (cached_pair_plan->types.internal == types.internal) && (cached_pair_plan->types.q_input == types.q_input) && (cached_pair_plan->types.q_rom == types.q_rom);
+        if( !reuse ){
+            sbg_plan_destroy( cached_pair_plan );
+            cached_pair_plan = sbg_plan_create(SIZE, RADIX, SW, GS, types);
+        }
+        sbg_plan_set_engine(cached_pair_plan, sbg_engine_from_name(p.exist("engine") ? p.toString("engine") : "fast"));
+        std::vector<float> X_R(FRAMES * BINS), X_I(FRAMES * BINS), Y_R(FRAMES * BINS), Y_I(FRAMES * BINS);
+        sbg_plan_execute_real_pair(cached_pair_plan, data.I.data(), data.Q.data(), X_R.data(), X_I.data(), Y_R.data(), Y_I.data(), FRAMES, &lib_sbg_radix_pool(THREADS));
+        for(int f = 0; f < FRAMES; f++){
+            out_R.insert(out_R.end(), X_R.begin() + f*BINS, X_R.begin() + (f+1)*BINS);
+            out_R.insert(out_R.end(), Y_R.begin() + f*BINS, Y_R.begin() + (f+1)*BINS);
+            out_I.insert(out_I.end(), X_I.begin() + f*BINS, X_I.begin() + (f+1)*BINS);
+            out_I.insert(out_I.end(), Y_I.begin() + f*BINS, Y_I.begin() + (f+1)*BINS);
+        }
+    }else{
+        std::cout << "(EE) Error in lib_sbg_radix_rfft function, unknown real mode [" << mode << "] (half or pair) !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    data.I = out_R;
+    data.Q = out_I;
+}
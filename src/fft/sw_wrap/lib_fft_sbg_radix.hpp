@@ -21,10 +21,72 @@
 #include "../../common/Parameters.hpp"
 #include "../../common/DataVector.hpp"
 #include "../module/fft_sbg_radix.hpp"
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_batch.hpp"
+#include "lib_fft_sbg_radix_real.hpp"
+#include "lib_fft_sbg_radix_bluestein.hpp"
+#include "lib_fft_sbg_radix_fourstep.hpp"
+#include "lib_fft_sbg_radix_2d.hpp"
+#include "lib_fft_sbg_radix_stft.hpp"
+#include "lib_fft_sbg_radix_conv.hpp"
+#include "lib_fft_sbg_radix_chan.hpp"
 #include "ap_int.h"
 
 
+/**
+ * @brief Engine selected by its command line name : fast, model or validate
+ */
+sbg_engine sbg_engine_from_name(const std::string& name);
+
+/**
+ * @brief Load the twiddle ROM of the cfile directory, sized from its files : they must hold at least SIZE
+ * twiddles, a larger ROM serving the smaller plans whose size divides it (see sbg_rom)
+ */
 void lib_fft_sbg_radix_load_fft_roms(std::string cfile, const int32_t SIZE);
+
+/**
+ * @brief Size of the ROM that lib_sbg_radix_fft needs for a SIZE points transform : SIZE itself, the convolution
+ * size of the chirp-z transform when SIZE is not a power of two, the size of the sub plans of the four-step
+ * transform when SIZE is larger than SBG_PLAN_MAX_SIZE
+ */
+int32_t lib_sbg_radix_rom_size(const int32_t SIZE);
+
+/**
+ * @brief FFT of the frames of data. With the parameters VALID_INPUTS, BINS_FIRST and BINS_LAST the transforms are
+ * pruned (see sbg_plan_set_pruning) : the samples of each frame from VALID_INPUTS onward are taken as zeros, and
+ * each spectrum is replaced by its bins BINS_FIRST..BINS_LAST.
+ */
 void lib_sbg_radix_fft(DataVector& data, Parameters& p);
 
+/**
+ * @brief Two-dimensional FFT of the frames of data : each FFT_SIZE frame holds ROWS rows of FFT_SIZE/ROWS samples,
+ * row-major, and is replaced by its row-major spectrum. The ROM must serve both dimensions.
+ */
+void lib_sbg_radix_fft2d(DataVector& data, Parameters& p);
+
+/**
+ * @brief STFT of data seen as a continuous stream (parameters STFT_HOP, window, kaiser_beta) : frames of FFT_SIZE
+ * samples every STFT_HOP samples, windowed. data is replaced by the spectra of the frames, one after the other.
+ */
+void lib_sbg_radix_stft(DataVector& data, Parameters& p);
+
+/**
+ * @brief FIR filter of data seen as a continuous stream, by fast convolution with FFT_SIZE points transforms
+ * (parameter conv : "save" or "add"). data is replaced by the filtered stream, of the same length.
+ */
+void lib_sbg_radix_fir(DataVector& data, const DataVector& taps, Parameters& p);
+
+/**
+ * @brief Polyphase channelizer of data seen as a continuous stream (parameters chan : "critical" or "oversampled",
+ * CHAN_TAPS, kaiser_beta) : FFT_SIZE channels. data is replaced by the channel streams, one after the other.
+ */
+void lib_sbg_radix_channelize(DataVector& data, Parameters& p);
+
+/**
+ * @brief Real input FFT of the frames of data (parameter real) : "half" transforms the real part with a FFT_SIZE/2
+ * points plan, "pair" transforms the real and imaginary parts as two real signals with one FFT_SIZE points plan.
+ * data is replaced by the FFT_SIZE/2+1 bins of each spectrum.
+ */
+void lib_sbg_radix_rfft(DataVector& data, Parameters& p);
+
 #endif // LIB_FFT_SBG_RADIX_HPP_
\ No newline at end of file
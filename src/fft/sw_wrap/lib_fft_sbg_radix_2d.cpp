@@ -0,0 +1,95 @@
+/**
+ * @file lib_fft_sbg_radix_2d.cpp
+ * @brief This file contains the two-dimensional transforms built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <utility>
+#include "lib_fft_sbg_radix_2d.hpp"
+#include "lib_fft_sbg_radix_batch.hpp"
+#include "lib_fft_sbg_radix_transpose.hpp"
+
+sbg_plan2d* sbg_plan2d_create(const int32_t ROWS, const int32_t COLS, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types, const int32_t nthreads){
+    if( (ROWS <= 0) || ((ROWS & (ROWS - 1)) != 0) || (COLS <= 0) || ((COLS & (COLS - 1)) != 0) ){
+        std::cout << "(EE) Error in sbg_plan2d_create function, the dimensions (" << ROWS << " x " << COLS << ") must be powers of two !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( types.internal != SBG_DTYPE_FLOAT ){
+        std::cout << "(EE) Error in sbg_plan2d_create function, the two-dimensional transform needs a float datapath !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const int64_t SIZE = (int64_t) ROWS * COLS;
+    sbg_plan2d* plan2d = new sbg_plan2d();
+    plan2d->ROWS      = ROWS;
+    plan2d->COLS      = COLS;
+    plan2d->direction = SBG_FORWARD;
+    plan2d->normalize = false;
+    plan2d->plan_row  = sbg_plan_create(COLS, RADIX, SW, GROUP, types);
+    plan2d->plan_col  = sbg_plan_create(ROWS, RADIX, SW, GROUP, types);
+    plan2d->pool      = new sbg_pool(nthreads);
+    plan2d->tmp_R     = new float[SIZE];
+    plan2d->tmp_I     = new float[SIZE];
+    return plan2d;
+}
+
+void sbg_plan2d_set_engine(sbg_plan2d* plan2d, const sbg_engine engine){
+    sbg_plan_set_engine(plan2d->plan_row, engine);
+    sbg_plan_set_engine(plan2d->plan_col, engine);
+}
+
+void sbg_plan2d_set_direction(sbg_plan2d* plan2d, const sbg_direction direction, const bool normalize){
+    plan2d->direction = direction;
+    plan2d->normalize = normalize;
+}
+
+void sbg_plan2d_execute(sbg_plan2d* plan2d, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count, const bool transposed_out){
+    const int32_t ROWS = plan2d->ROWS;
+    const int32_t COLS = plan2d->COLS;
+    const int64_t SIZE = (int64_t) ROWS * COLS;
+    sbg_pool& pool = *plan2d->pool;
+
+    const bool inverse = (plan2d->direction == SBG_INVERSE);
+    if( inverse ){
+        std::swap(in_R, in_I);
+        std::swap(out_R, out_I);
+    }
+    const float scale = (inverse && plan2d->normalize) ? 1.0f / SIZE : 1.0f;
+
+    for(int f = 0; f < count; f++, in_R += SIZE, in_I += SIZE, out_R += SIZE, out_I += SIZE){
+        // ROWS frames of COLS points
+        const sbg_frames rows = {in_R, in_I, plan2d->tmp_R, plan2d->tmp_I};
+        sbg_batch_execute(plan2d->plan_row, rows, ROWS, pool);
+
+        // COLS frames of ROWS points, contiguous
+        sbg_transpose(pool, plan2d->tmp_R, plan2d->tmp_I, out_R, out_I, ROWS, COLS, nullptr, nullptr, scale);
+        if( transposed_out ){
+            const sbg_frames cols = {out_R, out_I, out_R, out_I};
+            sbg_batch_execute(plan2d->plan_col, cols, COLS, pool);
+            continue;
+        }
+        const sbg_frames cols = {out_R, out_I, plan2d->tmp_R, plan2d->tmp_I};
+        sbg_batch_execute(plan2d->plan_col, cols, COLS, pool);
+
+        // back to row-major
+        sbg_transpose(pool, plan2d->tmp_R, plan2d->tmp_I, out_R, out_I, COLS, ROWS);
+    }
+}
+
+void sbg_plan2d_destroy(sbg_plan2d* plan2d){
+    if( plan2d == nullptr )
+        return;
+    sbg_plan_destroy(plan2d->plan_row);
+    sbg_plan_destroy(plan2d->plan_col);
+    delete plan2d->pool;
+    delete[] plan2d->tmp_R;
+    delete[] plan2d->tmp_I;
+    delete plan2d;
+}
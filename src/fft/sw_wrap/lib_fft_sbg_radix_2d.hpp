@@ -0,0 +1,76 @@
+/**
+ * @file lib_fft_sbg_radix_2d.hpp
+ * @brief This file contains the two-dimensional transforms built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_2D_HPP_
+#define LIB_FFT_SBG_RADIX_2D_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_pool.hpp"
+
+/**
+ * @brief Plan of a ROWS x COLS points two-dimensional FFT, row-major frames
+ *
+ * The ROWS rows are transformed as one batch of COLS points frames, the result is transposed by tiles so that the
+ * columns become contiguous, and the COLS columns are transformed as one batch of ROWS points frames. A last
+ * transpose restores the row-major order, it can be skipped when the caller consumes the spectrum column-major.
+ * Both batches and the transposes are spread over the workers of the plan pool.
+ *
+ */
+struct sbg_plan2d {
+    int32_t         ROWS;
+    int32_t         COLS;
+    sbg_direction   direction;  // SBG_FORWARD unless changed by sbg_plan2d_set_direction
+    bool            normalize;  // inverse outputs scaled by 1/(ROWS.COLS)
+    sbg_plan*       plan_row;   // COLS points plan
+    sbg_plan*       plan_col;   // ROWS points plan
+    sbg_pool*       pool;
+    float*          tmp_R;      // ROWS x COLS working frame
+    float*          tmp_I;
+};
+
+/**
+ * @brief Create a two-dimensional plan
+ *
+ * The loaded ROM must serve the ROWS and COLS points plans (see sbg_plan_create). The rows are transformed before
+ * the columns with no rescaling between the passes, through float buffers : the plan needs a float datapath.
+ *
+ * @param ROWS     Number of rows, a power of two
+ * @param COLS     Number of columns, a power of two
+ * @param RADIX    Core radix of the sub plans
+ * @param SW       Streaming width of the sub plans
+ * @param GROUP    Number of stages per group
+ * @param types    Numeric configuration (SBG_DTYPE_FLOAT)
+ * @param nthreads Number of workers, the hardware concurrency when <= 0
+ * @return sbg_plan2d* Plan to release with sbg_plan2d_destroy
+ */
+sbg_plan2d* sbg_plan2d_create(const int32_t ROWS, const int32_t COLS, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types, const int32_t nthreads);
+
+/**
+ * @brief Select the engine of the sub plans (see sbg_plan_set_engine)
+ */
+void sbg_plan2d_set_engine(sbg_plan2d* plan2d, const sbg_engine engine);
+
+/**
+ * @brief Select the direction of a plan (see sbg_plan_set_direction)
+ */
+void sbg_plan2d_set_direction(sbg_plan2d* plan2d, const sbg_direction direction, const bool normalize = false);
+
+/**
+ * @brief Compute count consecutive ROWS x COLS frames. in and out buffers may alias.
+ *
+ * @param transposed_out When true, each output frame is left column-major (COLS rows of ROWS bins, X[k1][k2] at
+ *                       k2.ROWS + k1), which saves the last transpose
+ */
+void sbg_plan2d_execute(sbg_plan2d* plan2d, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count = 1, const bool transposed_out = false);
+
+void sbg_plan2d_destroy(sbg_plan2d* plan2d);
+
+#endif // LIB_FFT_SBG_RADIX_2D_HPP_
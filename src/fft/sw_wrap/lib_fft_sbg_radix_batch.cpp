@@ -0,0 +1,42 @@
+/**
+ * @file lib_fft_sbg_radix_batch.cpp
+ * @brief This file contains the multi-threaded batch executor of the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <algorithm>
+#include <vector>
+#include "lib_fft_sbg_radix_batch.hpp"
+
+void sbg_batch_execute(sbg_plan* plan, const sbg_frames& frames, const int64_t count, sbg_pool& pool){
+    const int32_t workers = pool.size();
+    if( (workers == 1) || (count <= 1) ){
+        for(int64_t f = 0; f < count; f++){
+            const int64_t o = f * plan->SIZE;
+            sbg_plan_execute(plan, frames.in_R + o, frames.in_I + o, frames.out_R + o, frames.out_I + o);
+        }
+        return;
+    }
+
+    std::vector<sbg_scratch*> scratch(workers);
+    scratch[0] = plan->scratch;
+    for(int32_t w = 1; w < workers; w++)
+        scratch[w] = sbg_scratch_create(plan);
+
+    // A few chunks per worker leave room for stealing without contending on the deques for every frame
+    const int64_t grain = std::max<int64_t>(1, count / (8 * workers));
+
+    pool.parallel_for(count, grain, [&](const int32_t worker, const int64_t first, const int64_t last){
+        for(int64_t f = first; f < last; f++){
+            const int64_t o = f * plan->SIZE;
+            sbg_plan_execute_scratch(plan, scratch[worker], frames.in_R + o, frames.in_I + o, frames.out_R + o, frames.out_I + o);
+        }
+    });
+
+    for(int32_t w = 1; w < workers; w++)
+        sbg_scratch_destroy(plan, scratch[w]);
+}
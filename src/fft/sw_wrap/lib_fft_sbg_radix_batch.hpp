@@ -0,0 +1,42 @@
+/**
+ * @file lib_fft_sbg_radix_batch.hpp
+ * @brief This file contains the multi-threaded batch executor of the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_BATCH_HPP_
+#define LIB_FFT_SBG_RADIX_BATCH_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_pool.hpp"
+
+/**
+ * @brief Consecutive frames of plan->SIZE samples, in and out buffers may alias
+ */
+struct sbg_frames {
+    const float* in_R;
+    const float* in_I;
+    float*       out_R;
+    float*       out_I;
+};
+
+/**
+ * @brief Compute count independent frames with a plan, spread over the workers of a pool
+ *
+ * Each worker owns a scratch (the plan's one for the calling thread) and takes its frames from the
+ * work-stealing pool. The pool is created once by the caller and kept across calls, so that its threads
+ * are not started at each batch. The results do not depend on the number of threads.
+ *
+ * @param plan   Plan created by sbg_plan_create
+ * @param frames Frame buffers
+ * @param count  Number of frames
+ * @param pool   Workers of the batch
+ */
+void sbg_batch_execute(sbg_plan* plan, const sbg_frames& frames, const int64_t count, sbg_pool& pool);
+
+#endif // LIB_FFT_SBG_RADIX_BATCH_HPP_
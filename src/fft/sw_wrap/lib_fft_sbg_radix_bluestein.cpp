@@ -0,0 +1,136 @@
+/**
+ * @file lib_fft_sbg_radix_bluestein.cpp
+ * @brief This file contains the arbitrary length transforms (Bluestein chirp-z) built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include <utility>
+#include "lib_fft_sbg_radix_bluestein.hpp"
+
+int32_t sbg_bplan_conv_size(const int32_t SIZE){
+    int32_t CONV_SIZE = 16; // smallest instantiated plan
+    while( CONV_SIZE < 2*SIZE - 1 )
+        CONV_SIZE *= 2;
+    return CONV_SIZE;
+}
+
+sbg_bplan* sbg_bplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    if( SIZE <= 0 ){
+        std::cout << "(EE) Error in sbg_bplan_create function, the DFT length (" << SIZE << ") must be positive !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( types.internal != SBG_DTYPE_FLOAT ){
+        std::cout << "(EE) Error in sbg_bplan_create function, the chirp-z transform needs a float datapath !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const int32_t CONV_SIZE = sbg_bplan_conv_size(SIZE);
+    sbg_bplan* bplan = new sbg_bplan();
+    bplan->SIZE      = SIZE;
+    bplan->CONV_SIZE = CONV_SIZE;
+    bplan->direction = SBG_FORWARD;
+    bplan->normalize = false;
+    bplan->plan = sbg_plan_create(CONV_SIZE, RADIX, SW, GROUP, types);
+    bplan->w_R  = new float[SIZE];
+    bplan->w_I  = new float[SIZE];
+    bplan->b_R  = new float[CONV_SIZE];
+    bplan->b_I  = new float[CONV_SIZE];
+    bplan->a_R  = new float[CONV_SIZE];
+    bplan->a_I  = new float[CONV_SIZE];
+
+    // n^2 is reduced modulo 2.SIZE (the chirp period) before the phase is computed, so that long frames keep their accuracy
+    for(int64_t n = 0; n < SIZE; n++){
+        const double phase = M_PI * ((n * n) % (2 * (int64_t) SIZE)) / SIZE;
+        bplan->w_R[n] =  std::cos(phase);
+        bplan->w_I[n] = -std::sin(phase);
+    }
+
+    // conj(w[n]) on the circular support -(SIZE-1)..(SIZE-1), transformed once
+    for(int i = 0; i < CONV_SIZE; i++){
+        bplan->b_R[i] = 0.0f;
+        bplan->b_I[i] = 0.0f;
+    }
+    for(int n = 0; n < SIZE; n++){
+        bplan->b_R[n] =  bplan->w_R[n];
+        bplan->b_I[n] = -bplan->w_I[n];
+        bplan->b_R[(CONV_SIZE - n) % CONV_SIZE] =  bplan->w_R[n];
+        bplan->b_I[(CONV_SIZE - n) % CONV_SIZE] = -bplan->w_I[n];
+    }
+    sbg_plan_execute(bplan->plan, bplan->b_R, bplan->b_I, bplan->b_R, bplan->b_I);
+    for(int i = 0; i < CONV_SIZE; i++){
+        bplan->b_R[i] /= CONV_SIZE;
+        bplan->b_I[i] /= CONV_SIZE;
+    }
+    return bplan;
+}
+
+void sbg_bplan_set_direction(sbg_bplan* bplan, const sbg_direction direction, const bool normalize){
+    bplan->direction = direction;
+    bplan->normalize = normalize;
+}
+
+void sbg_bplan_execute(sbg_bplan* bplan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count){
+    const int32_t SIZE      = bplan->SIZE;
+    const int32_t CONV_SIZE = bplan->CONV_SIZE;
+    const float* w_R = bplan->w_R;
+    const float* w_I = bplan->w_I;
+    const float* b_R = bplan->b_R;
+    const float* b_I = bplan->b_I;
+    float* a_R = bplan->a_R;
+    float* a_I = bplan->a_I;
+
+    const bool inverse = (bplan->direction == SBG_INVERSE);
+    if( inverse ){
+        std::swap(in_R, in_I);
+        std::swap(out_R, out_I);
+    }
+    const float scale = (inverse && bplan->normalize) ? 1.0f / SIZE : 1.0f;
+
+    for(int f = 0; f < count; f++, in_R += SIZE, in_I += SIZE, out_R += SIZE, out_I += SIZE){
+        for(int n = 0; n < SIZE; n++){
+            a_R[n] = in_R[n] * w_R[n] - in_I[n] * w_I[n];
+            a_I[n] = in_R[n] * w_I[n] + in_I[n] * w_R[n];
+        }
+        for(int n = SIZE; n < CONV_SIZE; n++){
+            a_R[n] = 0.0f;
+            a_I[n] = 0.0f;
+        }
+
+        sbg_plan_set_direction(bplan->plan, SBG_FORWARD);
+        sbg_plan_execute(bplan->plan, a_R, a_I, a_R, a_I);
+        for(int i = 0; i < CONV_SIZE; i++){
+            const float t_R = a_R[i] * b_R[i] - a_I[i] * b_I[i];
+            const float t_I = a_R[i] * b_I[i] + a_I[i] * b_R[i];
+            a_R[i] = t_R;
+            a_I[i] = t_I;
+        }
+        sbg_plan_set_direction(bplan->plan, SBG_INVERSE);
+        sbg_plan_execute(bplan->plan, a_R, a_I, a_R, a_I);
+
+        for(int k = 0; k < SIZE; k++){
+            out_R[k] = (a_R[k] * w_R[k] - a_I[k] * w_I[k]) * scale;
+            out_I[k] = (a_R[k] * w_I[k] + a_I[k] * w_R[k]) * scale;
+        }
+    }
+}
+
+void sbg_bplan_destroy(sbg_bplan* bplan){
+    if( bplan == nullptr )
+        return;
+    sbg_plan_destroy(bplan->plan);
+    delete[] bplan->w_R;
+    delete[] bplan->w_I;
+    delete[] bplan->b_R;
+    delete[] bplan->b_I;
+    delete[] bplan->a_R;
+    delete[] bplan->a_I;
+    delete bplan;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file lib_fft_sbg_radix_bluestein.hpp
+ * @brief This file contains the arbitrary length transforms (Bluestein chirp-z) built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_BLUESTEIN_HPP_
+#define LIB_FFT_SBG_RADIX_BLUESTEIN_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_plan.hpp"
+
+/**
+ * @brief Arbitrary length DFT plan (Bluestein chirp-z)
+ *
+ * With the chirp w[n] = exp(-j.pi.n^2/SIZE), nk = (n^2 + k^2 - (k-n)^2)/2 turns the SIZE points DFT into a
+ * convolution : X[k] = w[k].sum x[n].w[n].conj(w[k-n]). The convolution is computed by two CONV_SIZE points
+ * sbg-radix transforms (CONV_SIZE the power of two >= 2.SIZE-1) and a pointwise product with the spectrum of the
+ * conjugate chirp, which is computed once by sbg_bplan_create and cached with the 1/CONV_SIZE scaling of the inverse
+ * transform. A frame then costs one forward transform, one inverse transform and three pointwise products.
+ *
+ */
+struct sbg_bplan {
+    int32_t         SIZE;       // DFT length, any value
+    int32_t         CONV_SIZE;  // length of the sbg-radix transforms
+    sbg_direction   direction;  // SBG_FORWARD unless changed by sbg_bplan_set_direction
+    bool            normalize;  // inverse outputs scaled by 1/SIZE
+    sbg_plan*       plan;       // CONV_SIZE points plan, run forward then inverse on each frame
+    float*          w_R;        // chirp w[n], n < SIZE
+    float*          w_I;
+    float*          b_R;        // cached spectrum of the conjugate chirp, scaled by 1/CONV_SIZE
+    float*          b_I;
+    float*          a_R;        // frame being convolved, transformed in place
+    float*          a_I;
+};
+
+/**
+ * @brief Length of the sbg-radix transforms used for a SIZE points DFT : the power of two >= 2.SIZE-1
+ */
+int32_t sbg_bplan_conv_size(const int32_t SIZE);
+
+/**
+ * @brief Create an arbitrary length DFT plan
+ *
+ * The loaded ROM must serve the sbg_bplan_conv_size(SIZE) points plan (see sbg_plan_create). The chirps and the
+ * frames are held in float : the plan needs a float datapath.
+ *
+ * @param SIZE  DFT length
+ * @param RADIX Core radix of the convolution plan
+ * @param SW    Streaming width of the convolution plan
+ * @param GROUP Number of stages per group
+ * @param types Numeric configuration (SBG_DTYPE_FLOAT)
+ * @return sbg_bplan* Plan to release with sbg_bplan_destroy
+ */
+sbg_bplan* sbg_bplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Select the direction of a plan (see sbg_plan_set_direction)
+ */
+void sbg_bplan_set_direction(sbg_bplan* bplan, const sbg_direction direction, const bool normalize = false);
+
+/**
+ * @brief Compute count consecutive frames of SIZE samples. in and out buffers may alias.
+ */
+void sbg_bplan_execute(sbg_bplan* bplan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count = 1);
+
+void sbg_bplan_destroy(sbg_bplan* bplan);
+
+#endif // LIB_FFT_SBG_RADIX_BLUESTEIN_HPP_
@@ -0,0 +1,192 @@
+/**
+ * @file lib_fft_sbg_radix_chan.cpp
+ * @brief This file contains the polyphase filter-bank channelizer built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "lib_fft_sbg_radix_chan.hpp"
+#include "lib_fft_sbg_radix_stft.hpp"
+
+sbg_chan_mode sbg_chan_mode_from_name(const std::string& name){
+    if( name == "critical"    ) return SBG_CHAN_CRITICAL;
+    if( name == "oversampled" ) return SBG_CHAN_OVERSAMPLED;
+    std::cout << "(EE) Error in sbg_chan_mode_from_name function, unknown mode [" << name << "] (critical or oversampled) !" << std::endl;
+    exit( EXIT_FAILURE );
+}
+
+void sbg_chan_prototype(const int32_t M, const int32_t P, const float beta, float* h){
+    const int32_t L = M * P;
+    std::vector<float> window(L);
+    sbg_window_fill(SBG_WINDOW_KAISER, L, window.data(), beta);
+
+    // the periodic Kaiser window is even around L/2, the sinc is centred there too
+    double sum = 0.0;
+    for(int n = 0; n < L; n++){
+        const double x = (double) (n - L/2) / M;
+        const double sinc = (n == L/2) ? 1.0 : std::sin(M_PI * x) / (M_PI * x);
+        h[n] = sinc * window[n];
+        sum += h[n];
+    }
+    for(int n = 0; n < L; n++)
+        h[n] /= sum;
+}
+
+sbg_chan* sbg_chan_create(const int32_t M, const int32_t P, const sbg_chan_mode mode, const float* h, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    if( (M < 2) || ((M & (M - 1)) != 0) ){
+        std::cout << "(EE) Error in sbg_chan_create function, the number of channels (" << M << ") must be a power of two !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( P <= 0 ){
+        std::cout << "(EE) Error in sbg_chan_create function, the number of taps per branch (" << P << ") must be positive !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const int32_t L = M * P;
+    int32_t CAPACITY = 1;
+    while( CAPACITY < 2*L )
+        CAPACITY *= 2;
+
+    sbg_chan* chan = new sbg_chan();
+    chan->M        = M;
+    chan->P        = P;
+    chan->L        = L;
+    chan->D        = (mode == SBG_CHAN_CRITICAL) ? M : M / 2;
+    chan->CAPACITY = CAPACITY;
+    chan->mode     = mode;
+    chan->plan     = sbg_plan_create(M, RADIX, SW, GROUP, types);
+    chan->g        = new float[L];
+    chan->ring_R   = new float[CAPACITY + L];
+    chan->ring_I   = new float[CAPACITY + L];
+    chan->z_R      = new float[M];
+    chan->z_I      = new float[M];
+    chan->y_R      = new float[SBG_CHAN_BLOCK * M];
+    chan->y_I      = new float[SBG_CHAN_BLOCK * M];
+    for(int j = 0; j < L; j++)
+        chan->g[j] = h[L - 1 - j];
+
+    sbg_chan_reset(chan);
+    return chan;
+}
+
+int32_t sbg_chan_max_frames(const sbg_chan* chan, const int32_t count){
+    return count / chan->D + 1;
+}
+
+// Folded frame starting at w, rotated by rot : z[(c + rot) mod M] = sum_p w[c+pM].g[c+pM]
+static void sbg_chan_fold(const sbg_chan* chan, const float* w_R, const float* w_I, const int32_t rot){
+    const int32_t M = chan->M;
+    const int32_t HEAD = M - rot; // branches c < HEAD land at c + rot, the other ones at c + rot - M
+    float* z_R = chan->z_R;
+    float* z_I = chan->z_I;
+    const float* g = chan->g;
+
+    for(int c = 0; c < HEAD; c++){
+        z_R[c + rot] = w_R[c] * g[c];
+        z_I[c + rot] = w_I[c] * g[c];
+    }
+    for(int c = HEAD; c < M; c++){
+        z_R[c - HEAD] = w_R[c] * g[c];
+        z_I[c - HEAD] = w_I[c] * g[c];
+    }
+    for(int p = 1; p < chan->P; p++){
+        const float* x_R = w_R + p * M;
+        const float* x_I = w_I + p * M;
+        const float* t   = g   + p * M;
+        for(int c = 0; c < HEAD; c++){
+            z_R[c + rot] += x_R[c] * t[c];
+            z_I[c + rot] += x_I[c] * t[c];
+        }
+        for(int c = HEAD; c < M; c++){
+            z_R[c - HEAD] += x_R[c] * t[c];
+            z_I[c - HEAD] += x_I[c] * t[c];
+        }
+    }
+}
+
+// Bins of the frames held in y spread to the channel streams, by runs of frames per channel
+static void sbg_chan_spread(const sbg_chan* chan, const int32_t frames, float* out_R, float* out_I, const int64_t stride){
+    const int32_t M = chan->M;
+    for(int k = 0; k < M; k++){
+        for(int f = 0; f < frames; f++){
+            out_R[k * stride + f] = chan->y_R[f * M + k];
+            out_I[k * stride + f] = chan->y_I[f * M + k];
+        }
+    }
+}
+
+int32_t sbg_chan_push(sbg_chan* chan, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I, const int64_t stride){
+    const int32_t M    = chan->M;
+    const int32_t L    = chan->L;
+    const int32_t D    = chan->D;
+    const int32_t mask = chan->CAPACITY - 1;
+    int32_t frames  = 0;
+    int32_t pending = 0;
+
+    int32_t consumed = 0;
+    while( consumed < count ){
+        // the ring holds the pending samples of the next frame, the remaining room is filled by at most two runs
+        const int32_t room = chan->CAPACITY - (chan->written - chan->next);
+        int32_t n = std::min(count - consumed, room);
+        while( n > 0 ){
+            const int32_t pos = chan->written & mask;
+            const int32_t run = std::min(n, chan->CAPACITY - pos);
+            std::copy(in_R + consumed, in_R + consumed + run, chan->ring_R + pos);
+            std::copy(in_I + consumed, in_I + consumed + run, chan->ring_I + pos);
+            if( pos < L ){
+                const int32_t mirrored = std::min(run, L - pos);
+                std::copy(in_R + consumed, in_R + consumed + mirrored, chan->ring_R + chan->CAPACITY + pos);
+                std::copy(in_I + consumed, in_I + consumed + mirrored, chan->ring_I + chan->CAPACITY + pos);
+            }
+            chan->written += run;
+            consumed      += run;
+            n             -= run;
+        }
+
+        while( chan->written - chan->next >= L ){
+            // the last sample of the frame is t = next + D - 1 of the stream, the rotation is (t + 1) mod M
+            const int32_t start = chan->next & mask;
+            sbg_chan_fold(chan, chan->ring_R + start, chan->ring_I + start, (chan->next + D) & (M - 1));
+            sbg_plan_execute(chan->plan, chan->z_R, chan->z_I, chan->y_R + pending * M, chan->y_I + pending * M);
+            chan->next += D;
+            if( ++pending == SBG_CHAN_BLOCK ){
+                sbg_chan_spread(chan, pending, out_R + frames, out_I + frames, stride);
+                frames += pending;
+                pending = 0;
+            }
+        }
+    }
+    sbg_chan_spread(chan, pending, out_R + frames, out_I + frames, stride);
+    return frames + pending;
+}
+
+void sbg_chan_reset(sbg_chan* chan){
+    std::fill(chan->ring_R, chan->ring_R + chan->CAPACITY + chan->L, 0.0f);
+    std::fill(chan->ring_I, chan->ring_I + chan->CAPACITY + chan->L, 0.0f);
+    // the first frame holds the L-D zeros ahead of the stream and its D first samples
+    chan->next    = 0;
+    chan->written = chan->L - chan->D;
+}
+
+void sbg_chan_destroy(sbg_chan* chan){
+    if( chan == nullptr )
+        return;
+    sbg_plan_destroy(chan->plan);
+    delete[] chan->g;
+    delete[] chan->ring_R;
+    delete[] chan->ring_I;
+    delete[] chan->z_R;
+    delete[] chan->z_I;
+    delete[] chan->y_R;
+    delete[] chan->y_I;
+    delete chan;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file lib_fft_sbg_radix_chan.hpp
+ * @brief This file contains the polyphase filter-bank channelizer built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_CHAN_HPP_
+#define LIB_FFT_SBG_RADIX_CHAN_HPP_
+
+#include <cstdint>
+#include <string>
+#include "lib_fft_sbg_radix_plan.hpp"
+
+/**
+ * @brief Output rate of the channelizer : one frame every M input samples, or every M/2 samples
+ */
+enum sbg_chan_mode {
+    SBG_CHAN_CRITICAL,      // decimation M, adjacent channels alias in their transition bands
+    SBG_CHAN_OVERSAMPLED    // decimation M/2, the transition bands stay free of aliases
+};
+
+/**
+ * @brief Mode selected by its command line name : critical or oversampled
+ */
+sbg_chan_mode sbg_chan_mode_from_name(const std::string& name);
+
+/**
+ * @brief Default prototype lowpass of a M channels bank : M.P taps of a sinc of cutoff 1/(2M) cycles per sample,
+ * Kaiser windowed, with a unit gain at DC
+ */
+void sbg_chan_prototype(const int32_t M, const int32_t P, const float beta, float* h);
+
+/**
+ * @brief Polyphase channelizer of a continuous stream : M channels, spaced by 1/M cycles per sample
+ *
+ * Channel k of frame m is the stream shifted down by k/M, filtered by the prototype h and decimated at the last
+ * sample t = (m+1).D - 1 of the frame : y_k[m] = sum_n h[n].x[t-n].exp(-2j.pi.k.(t-n)/M). With the M.P most recent
+ * samples w and the reversed prototype g, the M branches fold into z[c] = sum_p w[c+pM].g[c+pM], contiguous
+ * products that the compiler vectorises, and a circular rotation of z by t+1 (0 when critically sampled, 0 or M/2
+ * when oversampled) gives the M points FFT input. The stream is written once in a ring whose first M.P samples are
+ * mirrored after its end, so that each frame reads its M.P samples in place, without wrap.
+ *
+ */
+struct sbg_chan {
+    int32_t         M;          // channels, FFT size
+    int32_t         P;          // taps per branch
+    int32_t         L;          // prototype length M.P
+    int32_t         D;          // input samples per frame
+    int32_t         CAPACITY;   // ring length, a power of two >= 2.L
+    sbg_chan_mode   mode;
+    sbg_plan*       plan;
+    float*          g;          // reversed prototype, g[j] = h[L-1-j]
+    float*          ring_R;     // CAPACITY + L samples, the L last ones mirroring the L first ones
+    float*          ring_I;
+    float*          z_R;        // folded frame, FFT input
+    float*          z_I;
+    float*          y_R;        // spectra of SBG_CHAN_BLOCK frames, before they are spread to the channels
+    float*          y_I;
+    int64_t         written;    // samples written in the ring, including the L-D zeros of the initial history
+    int64_t         next;       // ring position of the first sample of the next frame
+};
+
+/**
+ * @brief Number of frames transformed before their bins are spread to the channel streams
+ */
+constexpr int32_t SBG_CHAN_BLOCK = 16;
+
+/**
+ * @brief Create a polyphase channelizer
+ *
+ * @param M     Number of channels (FFT size)
+ * @param P     Taps per branch
+ * @param mode  Critically sampled or 2x oversampled output
+ * @param h     Prototype lowpass of M.P taps (see sbg_chan_prototype)
+ * @param RADIX Core radix of the plan
+ * @param SW    Streaming width of the plan
+ * @param GROUP Number of stages per group
+ * @param types Numeric configuration
+ * @return sbg_chan* Channelizer to release with sbg_chan_destroy
+ */
+sbg_chan* sbg_chan_create(const int32_t M, const int32_t P, const sbg_chan_mode mode, const float* h, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Largest number of frames that a push of count samples can give
+ */
+int32_t sbg_chan_max_frames(const sbg_chan* chan, const int32_t count);
+
+/**
+ * @brief Push count samples of the stream, and compute the frames they complete
+ *
+ * @param in_R   Samples (real)
+ * @param in_I   Samples (imag)
+ * @param count  Number of samples
+ * @param out_R  Channel streams (real) : frame f of this push for channel k at out_R[k.stride + f]
+ * @param out_I  Channel streams (imag)
+ * @param stride Distance between two channel streams, at least sbg_chan_max_frames(count)
+ * @return int32_t Number of frames computed
+ */
+int32_t sbg_chan_push(sbg_chan* chan, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I, const int64_t stride);
+
+/**
+ * @brief Forget the stream : the filters restart from a zero history
+ */
+void sbg_chan_reset(sbg_chan* chan);
+
+void sbg_chan_destroy(sbg_chan* chan);
+
+#endif // LIB_FFT_SBG_RADIX_CHAN_HPP_
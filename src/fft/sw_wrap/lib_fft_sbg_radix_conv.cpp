@@ -0,0 +1,139 @@
+/**
+ * @file lib_fft_sbg_radix_conv.cpp
+ * @brief This file contains the block convolution (FIR filtering) of continuous streams built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include "lib_fft_sbg_radix_conv.hpp"
+
+sbg_conv_method sbg_conv_method_from_name(const std::string& name){
+    if( name == "save" ) return SBG_CONV_OVERLAP_SAVE;
+    if( name == "add"  ) return SBG_CONV_OVERLAP_ADD;
+    std::cout << "(EE) Error in sbg_conv_method_from_name function, unknown method [" << name << "] (save or add) !" << std::endl;
+    exit( EXIT_FAILURE );
+}
+
+int32_t sbg_conv_fft_size(const int32_t TAPS){
+    int32_t SIZE = 16; // smallest instantiated plan
+    while( SIZE < 4*TAPS )
+        SIZE *= 2;
+    return SIZE;
+}
+
+sbg_conv* sbg_conv_create(const float* h_R, const float* h_I, const int32_t TAPS, const int32_t SIZE, const sbg_conv_method method, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    if( (TAPS <= 0) || (SIZE < TAPS) ){
+        std::cout << "(EE) Error in sbg_conv_create function, the transform length (" << SIZE << ") must be at least the filter length (" << TAPS << ") !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    int32_t CAPACITY = 1;
+    while( CAPACITY < 2*SIZE )
+        CAPACITY *= 2;
+
+    sbg_conv* conv = new sbg_conv();
+    conv->SIZE     = SIZE;
+    conv->TAPS     = TAPS;
+    conv->BLOCK    = SIZE - TAPS + 1;
+    conv->CAPACITY = CAPACITY;
+    conv->method   = method;
+    conv->plan     = sbg_plan_create(SIZE, RADIX, SW, GROUP, types);
+    conv->ring_R   = new float[CAPACITY];
+    conv->ring_I   = new float[CAPACITY];
+    conv->y_R      = new float[SIZE];
+    conv->y_I      = new float[SIZE];
+    conv->acc_R    = new float[TAPS];
+    conv->acc_I    = new float[TAPS];
+
+    // taps zero padded to SIZE, transformed and converted to the datapath format once
+    std::vector<float> H_R(SIZE), H_I(SIZE);
+    for(int i = 0; i < SIZE; i++){
+        H_R[i] = (i < TAPS) ? h_R[i] : 0.0f;
+        H_I[i] = ((i < TAPS) && (h_I != nullptr)) ? h_I[i] : 0.0f;
+    }
+    sbg_plan_execute(conv->plan, H_R.data(), H_I.data(), H_R.data(), H_I.data());
+    conv->H = sbg_spectrum_create(conv->plan, H_R.data(), H_I.data());
+
+    sbg_conv_reset(conv);
+    return conv;
+}
+
+int32_t sbg_conv_max_output(const sbg_conv* conv, const int32_t count){
+    return count + conv->BLOCK;
+}
+
+int32_t sbg_conv_push(sbg_conv* conv, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I){
+    const int32_t SIZE  = conv->SIZE;
+    const int32_t BLOCK = conv->BLOCK;
+    const int32_t TAIL  = conv->TAPS - 1;
+    const int32_t mask  = conv->CAPACITY - 1;
+    // an overlap-save frame also holds the TAPS-1 samples preceding its block
+    const int32_t FRAME = (conv->method == SBG_CONV_OVERLAP_SAVE) ? SIZE : BLOCK;
+    int32_t produced = 0;
+
+    int32_t consumed = 0;
+    while( consumed < count ){
+        const int32_t room = conv->CAPACITY - (conv->written - conv->next);
+        const int32_t n    = std::min(count - consumed, room);
+        for(int i = 0; i < n; i++){
+            const int32_t pos = (conv->written + i) & mask;
+            conv->ring_R[pos] = in_R[consumed + i];
+            conv->ring_I[pos] = in_I[consumed + i];
+        }
+        conv->written += n;
+        consumed      += n;
+
+        while( conv->written - conv->next >= FRAME ){
+            if( conv->method == SBG_CONV_OVERLAP_SAVE ){
+                sbg_plan_execute_conv(conv->plan, conv->ring_R, conv->ring_I, mask, conv->next & mask, SIZE, conv->H, TAIL, out_R, out_I);
+            }else{
+                sbg_plan_execute_conv(conv->plan, conv->ring_R, conv->ring_I, mask, conv->next & mask, BLOCK, conv->H, 0, conv->y_R, conv->y_I);
+                for(int i = 0; i < BLOCK; i++){
+                    out_R[i] = conv->y_R[i] + ((i < TAIL) ? conv->acc_R[i] : 0.0f);
+                    out_I[i] = conv->y_I[i] + ((i < TAIL) ? conv->acc_I[i] : 0.0f);
+                }
+                for(int i = 0; i < TAIL; i++){
+                    conv->acc_R[i] = conv->y_R[BLOCK + i] + ((BLOCK + i < TAIL) ? conv->acc_R[BLOCK + i] : 0.0f);
+                    conv->acc_I[i] = conv->y_I[BLOCK + i] + ((BLOCK + i < TAIL) ? conv->acc_I[BLOCK + i] : 0.0f);
+                }
+            }
+            out_R      += BLOCK;
+            out_I      += BLOCK;
+            conv->next += BLOCK;
+            produced   += BLOCK;
+        }
+    }
+    return produced;
+}
+
+void sbg_conv_reset(sbg_conv* conv){
+    std::fill(conv->ring_R, conv->ring_R + conv->CAPACITY, 0.0f);
+    std::fill(conv->ring_I, conv->ring_I + conv->CAPACITY, 0.0f);
+    std::fill(conv->acc_R,  conv->acc_R  + conv->TAPS, 0.0f);
+    std::fill(conv->acc_I,  conv->acc_I  + conv->TAPS, 0.0f);
+    // the overlap-save history of the first block is the TAPS-1 zeros ahead of the stream
+    conv->next    = 0;
+    conv->written = (conv->method == SBG_CONV_OVERLAP_SAVE) ? conv->TAPS - 1 : 0;
+}
+
+void sbg_conv_destroy(sbg_conv* conv){
+    if( conv == nullptr )
+        return;
+    sbg_spectrum_destroy(conv->plan, conv->H);
+    sbg_plan_destroy(conv->plan);
+    delete[] conv->ring_R;
+    delete[] conv->ring_I;
+    delete[] conv->y_R;
+    delete[] conv->y_I;
+    delete[] conv->acc_R;
+    delete[] conv->acc_I;
+    delete conv;
+}
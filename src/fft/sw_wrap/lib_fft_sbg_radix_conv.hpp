@@ -0,0 +1,106 @@
+/**
+ * @file lib_fft_sbg_radix_conv.hpp
+ * @brief This file contains the block convolution (FIR filtering) of continuous streams built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_CONV_HPP_
+#define LIB_FFT_SBG_RADIX_CONV_HPP_
+
+#include <cstdint>
+#include <string>
+#include "lib_fft_sbg_radix_plan.hpp"
+
+/**
+ * @brief Block convolution method
+ */
+enum sbg_conv_method {
+    SBG_CONV_OVERLAP_SAVE,  // frames of SIZE samples overlapping by TAPS-1, the wrapped outputs are dropped
+    SBG_CONV_OVERLAP_ADD    // blocks of BLOCK samples zero padded to SIZE, the tails are added to the next outputs
+};
+
+/**
+ * @brief Method selected by its command line name : save or add
+ */
+sbg_conv_method sbg_conv_method_from_name(const std::string& name);
+
+/**
+ * @brief FIR filter of a continuous stream by fast convolution
+ *
+ * y[n] = sum h[k].x[n-k], computed by blocks of BLOCK = SIZE - TAPS + 1 samples with one forward and one inverse
+ * SIZE points transform each. The spectrum of the taps is computed once by sbg_conv_create and cached, and the
+ * product, scaled by 1/SIZE, is fused between the two transforms (sbg_plan_execute_conv). The stream is written
+ * once in a ring buffer and the blocks are read in place.
+ *
+ */
+struct sbg_conv {
+    int32_t         SIZE;       // transform length
+    int32_t         TAPS;       // filter length
+    int32_t         BLOCK;      // output samples per transform
+    int32_t         CAPACITY;   // ring length
+    sbg_conv_method method;
+    sbg_plan*       plan;
+    sbg_spectrum*   H;          // cached spectrum of the taps, in the twiddle format of the plan
+    float*          ring_R;
+    float*          ring_I;
+    float*          y_R;        // circular convolution of the current block (overlap-add)
+    float*          y_I;
+    float*          acc_R;      // tails waiting for the next block (overlap-add), TAPS-1 samples
+    float*          acc_I;
+    int64_t         written;    // stream samples written in the ring
+    int64_t         next;       // stream position of the next block
+};
+
+/**
+ * @brief Default transform length for TAPS taps : the power of two >= 4.TAPS, so that at least 3/4 of each
+ * transform gives outputs
+ */
+int32_t sbg_conv_fft_size(const int32_t TAPS);
+
+/**
+ * @brief Create a block convolution
+ *
+ * The loaded ROM must serve the SIZE points plan (see sbg_plan_create). The spectrum product runs on the datapath
+ * values : on a fixed point datapath, the spectrum is quantified like the twiddles.
+ *
+ * @param h_R    Taps (real)
+ * @param h_I    Taps (imag), nullptr for a real filter
+ * @param TAPS   Filter length
+ * @param SIZE   Transform length, > TAPS-1 (see sbg_conv_fft_size)
+ * @param method Overlap-save or overlap-add
+ * @param RADIX  Core radix of the plan
+ * @param SW     Streaming width of the plan
+ * @param GROUP  Number of stages per group
+ * @param types  Numeric configuration
+ * @return sbg_conv* Convolution to release with sbg_conv_destroy
+ */
+sbg_conv* sbg_conv_create(const float* h_R, const float* h_I, const int32_t TAPS, const int32_t SIZE, const sbg_conv_method method, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Largest number of output samples that a push of count samples can give
+ */
+int32_t sbg_conv_max_output(const sbg_conv* conv, const int32_t count);
+
+/**
+ * @brief Push count samples of the stream, and filter the blocks they complete
+ *
+ * The outputs are given by whole blocks : y[n] is returned by the push that completes the block of x[n].
+ *
+ * @param out_R Filtered samples (real), room for sbg_conv_max_output(count) samples
+ * @param out_I Filtered samples (imag)
+ * @return int32_t Number of output samples, a multiple of BLOCK
+ */
+int32_t sbg_conv_push(sbg_conv* conv, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I);
+
+/**
+ * @brief Forget the stream : the filter state is cleared
+ */
+void sbg_conv_reset(sbg_conv* conv);
+
+void sbg_conv_destroy(sbg_conv* conv);
+
+#endif // LIB_FFT_SBG_RADIX_CONV_HPP_
@@ -0,0 +1,114 @@
+/**
+ * @file lib_fft_sbg_radix_fourstep.cpp
+ * @brief This file contains the four-step decomposition of the very large transforms on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include <utility>
+#include "lib_fft_sbg_radix_fourstep.hpp"
+#include "lib_fft_sbg_radix_batch.hpp"
+#include "lib_fft_sbg_radix_transpose.hpp"
+
+void sbg_fplan_split(const int32_t SIZE, int32_t& N1, int32_t& N2){
+    const int32_t LOG2N = std::log2(SIZE);
+    N2 = 1 << (LOG2N / 2);
+    N1 = SIZE / N2;
+}
+
+sbg_fplan* sbg_fplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types, const int32_t nthreads){
+    if( (SIZE < 256) || ((SIZE & (SIZE - 1)) != 0) ){
+        std::cout << "(EE) Error in sbg_fplan_create function, the FFT size (" << SIZE << ") must be a power of two of at least 256 points !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( types.internal != SBG_DTYPE_FLOAT ){
+        std::cout << "(EE) Error in sbg_fplan_create function, the four-step transform needs a float datapath !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    sbg_fplan* fplan = new sbg_fplan();
+    fplan->SIZE = SIZE;
+    sbg_fplan_split(SIZE, fplan->N1, fplan->N2);
+    fplan->direction = SBG_FORWARD;
+    fplan->normalize = false;
+    fplan->plan_N1 = sbg_plan_create(fplan->N1, RADIX, SW, GROUP, types);
+    fplan->plan_N2 = sbg_plan_create(fplan->N2, RADIX, SW, GROUP, types);
+    fplan->pool  = new sbg_pool(nthreads);
+    fplan->tw_R  = new float[SIZE];
+    fplan->tw_I  = new float[SIZE];
+    fplan->buf_R = new float[SIZE];
+    fplan->buf_I = new float[SIZE];
+    fplan->tmp_R = new float[SIZE];
+    fplan->tmp_I = new float[SIZE];
+
+    for(int64_t n1 = 0; n1 < fplan->N1; n1++){
+        for(int64_t k2 = 0; k2 < fplan->N2; k2++){
+            const double phase = 2.0 * M_PI * ((n1 * k2) % SIZE) / SIZE;
+            fplan->tw_R[n1 * fplan->N2 + k2] =  std::cos(phase);
+            fplan->tw_I[n1 * fplan->N2 + k2] = -std::sin(phase);
+        }
+    }
+    return fplan;
+}
+
+void sbg_fplan_set_engine(sbg_fplan* fplan, const sbg_engine engine){
+    sbg_plan_set_engine(fplan->plan_N1, engine);
+    sbg_plan_set_engine(fplan->plan_N2, engine);
+}
+
+void sbg_fplan_set_direction(sbg_fplan* fplan, const sbg_direction direction, const bool normalize){
+    fplan->direction = direction;
+    fplan->normalize = normalize;
+}
+
+void sbg_fplan_execute(sbg_fplan* fplan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count){
+    const int32_t SIZE = fplan->SIZE;
+    const int32_t N1   = fplan->N1;
+    const int32_t N2   = fplan->N2;
+    sbg_pool& pool = *fplan->pool;
+
+    const bool inverse = (fplan->direction == SBG_INVERSE);
+    if( inverse ){
+        std::swap(in_R, in_I);
+        std::swap(out_R, out_I);
+    }
+    const float scale = (inverse && fplan->normalize) ? 1.0f / SIZE : 1.0f;
+
+    const sbg_frames buf = {fplan->buf_R, fplan->buf_I, fplan->buf_R, fplan->buf_I};
+    const sbg_frames tmp = {fplan->tmp_R, fplan->tmp_I, fplan->tmp_R, fplan->tmp_I};
+
+    for(int f = 0; f < count; f++, in_R += SIZE, in_I += SIZE, out_R += SIZE, out_I += SIZE){
+        // N2 rows of N1 -> N1 contiguous columns of N2, transformed
+        sbg_transpose(pool, in_R, in_I, fplan->buf_R, fplan->buf_I, N2, N1, nullptr, nullptr, 1.0f);
+        sbg_batch_execute(fplan->plan_N2, buf, N1, pool);
+
+        // twiddled back to N2 rows of N1, transformed
+        sbg_transpose(pool, fplan->buf_R, fplan->buf_I, fplan->tmp_R, fplan->tmp_I, N1, N2, fplan->tw_R, fplan->tw_I, 1.0f);
+        sbg_batch_execute(fplan->plan_N1, tmp, N2, pool);
+
+        // X[k2 + N2.k1] : natural order
+        sbg_transpose(pool, fplan->tmp_R, fplan->tmp_I, out_R, out_I, N2, N1, nullptr, nullptr, scale);
+    }
+}
+
+void sbg_fplan_destroy(sbg_fplan* fplan){
+    if( fplan == nullptr )
+        return;
+    sbg_plan_destroy(fplan->plan_N1);
+    sbg_plan_destroy(fplan->plan_N2);
+    delete fplan->pool;
+    delete[] fplan->tw_R;
+    delete[] fplan->tw_I;
+    delete[] fplan->buf_R;
+    delete[] fplan->buf_I;
+    delete[] fplan->tmp_R;
+    delete[] fplan->tmp_I;
+    delete fplan;
+}
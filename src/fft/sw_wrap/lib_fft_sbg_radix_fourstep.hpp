@@ -0,0 +1,85 @@
+/**
+ * @file lib_fft_sbg_radix_fourstep.hpp
+ * @brief This file contains the four-step decomposition of the very large transforms on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_FOURSTEP_HPP_
+#define LIB_FFT_SBG_RADIX_FOURSTEP_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_pool.hpp"
+
+/**
+ * @brief Four-step plan of a SIZE = N1 x N2 points FFT
+ *
+ * The input, seen as N2 rows of N1 samples x[n1 + N1.n2], is transposed so that its N1 columns are contiguous, and
+ * the N1 columns are transformed by N2 points plans. Each column n1 is multiplied by W_SIZE^(n1.k2) while it is
+ * transposed back, the N2 rows are transformed by N1 points plans, and a last transpose gives
+ * X[k2 + N2.k1] in natural order. The transposes work on square tiles that fit in L1, the transforms and the
+ * transposes are spread over the workers of the plan pool : each sub-transform keeps the working set of a small
+ * plan, whatever SIZE.
+ *
+ */
+struct sbg_fplan {
+    int32_t         SIZE;
+    int32_t         N1;         // row length, transformed last
+    int32_t         N2;         // column length, transformed first
+    sbg_direction   direction;  // SBG_FORWARD unless changed by sbg_fplan_set_direction
+    bool            normalize;  // inverse outputs scaled by 1/SIZE
+    sbg_plan*       plan_N1;
+    sbg_plan*       plan_N2;
+    sbg_pool*       pool;
+    float*          tw_R;       // W_SIZE^(n1.k2), N1 rows of N2 values
+    float*          tw_I;
+    float*          buf_R;      // transposed frames
+    float*          buf_I;
+    float*          tmp_R;
+    float*          tmp_I;
+};
+
+/**
+ * @brief Balanced split of a power of two SIZE : N2 = 2^floor(log2(SIZE)/2) and N1 = SIZE/N2
+ */
+void sbg_fplan_split(const int32_t SIZE, int32_t& N1, int32_t& N2);
+
+/**
+ * @brief Create a four-step plan
+ *
+ * The loaded ROM must serve the N1 and N2 points plans (see sbg_plan_create and sbg_fplan_split), the twiddles
+ * of the whole transform are computed by the plan. The intermediate results grow by N2 between the two passes and
+ * are held in float : the plan needs a float datapath.
+ *
+ * @param SIZE     FFT size, a power of two
+ * @param RADIX    Core radix of the sub plans
+ * @param SW       Streaming width of the sub plans
+ * @param GROUP    Number of stages per group
+ * @param types    Numeric configuration (SBG_DTYPE_FLOAT)
+ * @param nthreads Number of workers, the hardware concurrency when <= 0
+ * @return sbg_fplan* Plan to release with sbg_fplan_destroy
+ */
+sbg_fplan* sbg_fplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types, const int32_t nthreads);
+
+/**
+ * @brief Select the engine of the sub plans (see sbg_plan_set_engine)
+ */
+void sbg_fplan_set_engine(sbg_fplan* fplan, const sbg_engine engine);
+
+/**
+ * @brief Select the direction of a plan (see sbg_plan_set_direction)
+ */
+void sbg_fplan_set_direction(sbg_fplan* fplan, const sbg_direction direction, const bool normalize = false);
+
+/**
+ * @brief Compute count consecutive frames of SIZE samples. in and out buffers may alias.
+ */
+void sbg_fplan_execute(sbg_fplan* fplan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count = 1);
+
+void sbg_fplan_destroy(sbg_fplan* fplan);
+
+#endif // LIB_FFT_SBG_RADIX_FOURSTEP_HPP_
@@ -0,0 +1,183 @@
+/**
+ * @file lib_fft_sbg_radix_plan.cpp
+ * @brief This file contains the reusable plan object of the sbg-radix software model
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_registry.hpp"
+
+sbg_plan_bind_fn sbg_registry_lookup(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_dtype dtype){
+    const int index = sbg_registry_index(SIZE, RADIX, SW, GROUP);
+    if( index < 0 )
+        return nullptr;
+    switch( dtype ){
+        case SBG_DTYPE_FLOAT : return sbg_registry_float[index];
+        case SBG_DTYPE_FIXED : return sbg_registry_fixed[index];
+        case SBG_DTYPE_FAST_FIXED : return sbg_registry_fast_fixed[index];
+        case SBG_DTYPE_DOUBLE : return sbg_registry_double[index];
+        default              : return nullptr;
+    }
+}
+
+sbg_plan* sbg_plan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    const sbg_rom& rom = lib_fft_sbg_radix_roms();
+    if( rom.SIZE == 0 ){
+        std::cout << "(EE) Kastner Lut ROM not loaded !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( (SIZE <= 0) || (rom.SIZE % SIZE != 0) ){
+        std::cout << "(EE) Error in sbg_plan_create function, the loaded ROM (" << rom.SIZE << " points) cannot serve a " << SIZE << " points FFT !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    sbg_plan* plan = new sbg_plan();
+    plan->SIZE  = SIZE;
+    plan->RADIX = RADIX;
+    plan->SW    = SW;
+    plan->GROUP = GROUP;
+    plan->types = types;
+    plan->engine = SBG_ENGINE_FAST;
+    plan->direction = SBG_FORWARD;
+    plan->normalize = false;
+    plan->prune = nullptr;
+
+    if( ((types.internal == SBG_DTYPE_FLOAT) || (types.internal == SBG_DTYPE_DOUBLE)) && (types.q_rom == 0) ){
+        plan->Q = 0;
+    }else if( ((types.internal == SBG_DTYPE_FIXED) || (types.internal == SBG_DTYPE_FAST_FIXED)) && (types.q_input > 0) && (types.q_rom > 0) ){
+        plan->Q = types.q_rom - 3; // Q = QN.D with N = 2
+    }else{
+        std::cout << "(EE) Error in sbg_plan_create function, the numeric configuration is not supported !" << std::endl;
+        std::cout << "(EE) q_input    =  [" << types.q_input << "]" << std::endl;
+        std::cout << "(EE) q_rom      =  [" << types.q_rom   << "]" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const sbg_plan_bind_fn bind = sbg_registry_lookup(SIZE, RADIX, SW, GROUP, types.internal);
+    if( bind == nullptr ){
+        std::cout << "(EE) Error in sbg_plan_create function, the FFT configuration is not instantiated !" << std::endl;
+        std::cout << "(EE) SIZE  = " << SIZE  << std::endl;
+        std::cout << "(EE) RADIX = " << RADIX << std::endl;
+        std::cout << "(EE) SW    = " << SW    << std::endl;
+        std::cout << "(EE) GROUP = " << GROUP << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    bind(plan);
+    return plan;
+}
+
+void sbg_plan_set_engine(sbg_plan* plan, const sbg_engine engine){
+    plan->engine = engine;
+}
+
+void sbg_plan_set_direction(sbg_plan* plan, const sbg_direction direction, const bool normalize){
+    plan->direction = direction;
+    plan->normalize = normalize;
+}
+
+void sbg_plan_set_pruning(sbg_plan* plan, const int32_t valid, const int32_t first, const int32_t last){
+    if( (valid < 1) || (valid > plan->SIZE) || (first < 0) || (first > last) || (last >= plan->SIZE) ){
+        std::cout << "(EE) Error in sbg_plan_set_pruning function, the pruning does not fit a " << plan->SIZE << " points FFT !" << std::endl;
+        std::cout << "(EE) valid = " << valid << std::endl;
+        std::cout << "(EE) bins  = " << first << ":" << last << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( plan->prune != nullptr ){
+        delete[] plan->prune->masks;
+        delete plan->prune;
+        plan->prune = nullptr;
+    }
+    if( (valid == plan->SIZE) && (first == 0) && (last == plan->SIZE-1) )
+        return;
+
+    plan->prune = new sbg_prune();
+    plan->prune->valid = valid;
+    plan->prune->first = first;
+    plan->prune->last  = last;
+    plan->prune_fill(plan, plan->prune);
+}
+
+void sbg_plan_execute(sbg_plan* plan, const float* in_R, const float* in_I, float* out_R, float* out_I){
+    plan->kernel(plan, plan->scratch, in_R, in_I, out_R, out_I);
+}
+
+void sbg_plan_execute_batch(sbg_plan* plan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count){
+    const int32_t SIZE = plan->SIZE;
+    for(int f = 0; f < count; f++)
+        plan->kernel(plan, plan->scratch, in_R + f*SIZE, in_I + f*SIZE, out_R + f*SIZE, out_I + f*SIZE);
+}
+
+void sbg_plan_execute_fixed(sbg_plan* plan, const int32_t* in_R, const int32_t* in_I, int32_t* out_R, int32_t* out_I, const int32_t count){
+    if( plan->kernel_fixed == nullptr ){
+        std::cout << "(EE) Error in sbg_plan_execute_fixed function, the plan does not use a fixed point datapath !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    const int32_t SIZE = plan->SIZE;
+    for(int f = 0; f < count; f++)
+        plan->kernel_fixed(plan, plan->scratch, in_R + f*SIZE, in_I + f*SIZE, out_R + f*SIZE, out_I + f*SIZE);
+}
+
+void sbg_plan_execute_double(sbg_plan* plan, const double* in_R, const double* in_I, double* out_R, double* out_I, const int32_t count){
+    if( plan->kernel_double == nullptr ){
+        std::cout << "(EE) Error in sbg_plan_execute_double function, the plan does not use a double datapath !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    const int32_t SIZE = plan->SIZE;
+    for(int f = 0; f < count; f++)
+        plan->kernel_double(plan, plan->scratch, in_R + f*SIZE, in_I + f*SIZE, out_R + f*SIZE, out_I + f*SIZE);
+}
+
+void sbg_plan_execute_window(sbg_plan* plan, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const float* window, float* out_R, float* out_I){
+    plan->kernel_window(plan, plan->scratch, ring_R, ring_I, mask, start, window, out_R, out_I);
+}
+
+void sbg_plan_execute_conv(sbg_plan* plan, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const int32_t count, const sbg_spectrum* H, const int32_t skip, float* out_R, float* out_I){
+    if( plan->prune != nullptr ){
+        std::cout << "(EE) Error in sbg_plan_execute_conv function, the plan is pruned !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( plan->direction != SBG_FORWARD ){
+        std::cout << "(EE) Error in sbg_plan_execute_conv function, the plan direction must be SBG_FORWARD !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    plan->kernel_conv(plan, plan->scratch, ring_R, ring_I, mask, start, count, H, skip, out_R, out_I);
+}
+
+sbg_spectrum* sbg_spectrum_create(const sbg_plan* plan, const float* H_R, const float* H_I){
+    return plan->spectrum_create(plan, H_R, H_I);
+}
+
+void sbg_spectrum_destroy(const sbg_plan* plan, sbg_spectrum* H){
+    if( H != nullptr )
+        plan->spectrum_release(H);
+}
+
+sbg_scratch* sbg_scratch_create(const sbg_plan* plan){
+    return plan->scratch_create(plan);
+}
+
+void sbg_scratch_destroy(const sbg_plan* plan, sbg_scratch* scratch){
+    if( scratch != nullptr )
+        plan->scratch_release(scratch);
+}
+
+void sbg_plan_execute_scratch(const sbg_plan* plan, sbg_scratch* scratch, const float* in_R, const float* in_I, float* out_R, float* out_I){
+    plan->kernel(plan, scratch, in_R, in_I, out_R, out_I);
+}
+
+void sbg_plan_destroy(sbg_plan* plan){
+    if( plan == nullptr )
+        return;
+    sbg_scratch_destroy(plan, plan->scratch);
+    sbg_plan_set_pruning(plan, plan->SIZE, 0, plan->SIZE-1);
+    plan->release(plan);
+    delete plan;
+}
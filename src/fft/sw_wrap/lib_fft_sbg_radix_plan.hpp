@@ -0,0 +1,283 @@
+/**
+ * @file lib_fft_sbg_radix_plan.hpp
+ * @brief This file contains the reusable plan object of the sbg-radix software model
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_PLAN_HPP_
+#define LIB_FFT_SBG_RADIX_PLAN_HPP_
+
+#include <cstdint>
+
+/**
+ * @brief Largest instantiated plan (SBG_RADIX_CONFIGS), the larger transforms are decomposed (see sbg_fplan)
+ */
+constexpr int32_t SBG_PLAN_MAX_SIZE = 65536;
+
+/**
+ * @brief Datapath type used by a plan
+ */
+enum sbg_dtype {
+    SBG_DTYPE_FLOAT,        // float data, float twiddles
+    SBG_DTYPE_FIXED,        // ap_int<32> data and twiddles, ap_int<64> products
+    SBG_DTYPE_FAST_FIXED,   // same arithmetic as SBG_DTYPE_FIXED on native integers (fast_fixed<32>, fast_fixed<64>)
+    SBG_DTYPE_DOUBLE        // double data, double twiddles
+};
+
+/**
+ * @brief Software engine executing a plan
+ */
+enum sbg_engine {
+    SBG_ENGINE_FAST,        // constant geometry engine (sbg_radix_fft_fast), bit-identical to the model
+    SBG_ENGINE_MODEL,       // streaming architecture model : stage buffers and permutations (sbg_radix_fft_sw)
+    SBG_ENGINE_VALIDATE     // both engines, the outputs are compared and any difference is fatal
+};
+
+/**
+ * @brief Transform direction of a plan
+ */
+enum sbg_direction {
+    SBG_FORWARD,            // X[k] = sum x[n].exp(-2j.pi.nk/N)
+    SBG_INVERSE             // x[n] = sum X[k].exp(+2j.pi.nk/N), optionally scaled by 1/N
+};
+
+/**
+ * @brief Numeric configuration of a plan
+ *
+ * A quantification set to 0 means that the corresponding values are floating point
+ *
+ */
+struct sbg_types {
+    sbg_dtype internal;
+    int32_t   q_input;
+    int32_t   q_rom;
+};
+
+/**
+ * @brief Twiddle ROM shared by the plans, as loaded by lib_fft_sbg_radix_load_fft_roms
+ *
+ * A ROM of size N can serve every plan whose size divides N
+ *
+ */
+struct sbg_rom {
+    int32_t  SIZE;
+    float*   cos;
+    float*   sin;
+    double*  cos_double;
+    double*  sin_double;
+    int64_t* cos_fixed;
+    int64_t* sin_fixed;
+};
+
+struct sbg_plan;
+
+/**
+ * @brief Per-execution state of a plan : stage buffers of the model (sbg_radix_ctx) and I/O buffers
+ * in the datapath format. A thread executing a plan needs its own scratch.
+ */
+struct sbg_scratch {
+    void*           context;
+    void*           buf_in_R;
+    void*           buf_in_I;
+    void*           buf_out_R;
+    void*           buf_out_I;
+};
+
+/**
+ * @brief Pruning of a plan : known zero input samples and bins that are read (see sbg_plan_set_pruning)
+ */
+struct sbg_prune {
+    int32_t         valid;      // input samples from valid onward are zero
+    int32_t         first;      // first bin written
+    int32_t         last;       // last bin written
+    int32_t         packets;    // packets of the fast engine, all stages
+    int32_t         computed;   // packets that still go through the twiddling and dft
+    uint8_t*        masks;      // packet actions of the fast engine (fft_sbg_radix_prune_fill)
+};
+
+/**
+ * @brief Spectrum converted once to the twiddle format of a plan, for sbg_plan_execute_conv (see sbg_spectrum_create)
+ */
+struct sbg_spectrum {
+    void*           R;
+    void*           I;
+};
+
+typedef void (*sbg_plan_kernel)(const sbg_plan* plan, sbg_scratch* scratch, const float* in_R, const float* in_I, float* out_R, float* out_I);
+typedef void (*sbg_plan_fixed_kernel)(const sbg_plan* plan, sbg_scratch* scratch, const int32_t* in_R, const int32_t* in_I, int32_t* out_R, int32_t* out_I);
+typedef void (*sbg_plan_double_kernel)(const sbg_plan* plan, sbg_scratch* scratch, const double* in_R, const double* in_I, double* out_R, double* out_I);
+typedef void (*sbg_plan_conv_kernel)(const sbg_plan* plan, sbg_scratch* scratch, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const int32_t count, const sbg_spectrum* H, const int32_t skip, float* out_R, float* out_I);
+typedef void (*sbg_plan_window_kernel)(const sbg_plan* plan, sbg_scratch* scratch, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const float* window, float* out_R, float* out_I);
+
+/**
+ * @brief FFT plan : everything that does not depend on the processed frame
+ *
+ * The model instantiation, the permutation configurations, the twiddle tables converted to the
+ * datapath format and the scratch buffers are resolved once by sbg_plan_create and reused by
+ * every sbg_plan_execute call. The plan itself is read-only once created : sbg_plan_execute uses
+ * the scratch owned by the plan, other threads execute it with their own scratch
+ * (sbg_scratch_create, sbg_plan_execute_scratch).
+ *
+ */
+struct sbg_plan {
+    int32_t         SIZE;
+    int32_t         RADIX;
+    int32_t         SW;
+    int32_t         GROUP;
+    sbg_types       types;
+    int32_t         Q;          // fractional bits of the twiddles given to the model
+    sbg_engine      engine;     // SBG_ENGINE_FAST unless changed by sbg_plan_set_engine
+    sbg_direction   direction;  // SBG_FORWARD unless changed by sbg_plan_set_direction
+    bool            normalize;  // inverse outputs scaled by 1/SIZE
+
+    sbg_plan_kernel kernel;     // resolved sbg_radix_fft instantiation
+    sbg_plan_fixed_kernel kernel_fixed; // same instantiation with raw fixed point I/O (fixed point datapaths only)
+    sbg_plan_double_kernel kernel_double; // same instantiation with double I/O (double datapath only)
+    sbg_plan_window_kernel kernel_window; // same instantiation, frame read from a ring buffer and windowed by the input pass
+    sbg_plan_conv_kernel kernel_conv; // forward transform, spectrum product and inverse transform of a ring frame
+    void          (*release)(sbg_plan* plan);
+    void          (*prune_fill)(const sbg_plan* plan, sbg_prune* prune); // packet masks of the instantiation
+    sbg_scratch*  (*scratch_create)(const sbg_plan* plan);
+    void          (*scratch_release)(sbg_scratch* scratch);
+    sbg_spectrum* (*spectrum_create)(const sbg_plan* plan, const float* H_R, const float* H_I);
+    void          (*spectrum_release)(sbg_spectrum* H);
+
+    void*           configs;    // digit-reverse and stride perm_config of the instantiation
+    void*           tw_R;       // twiddles in the datapath format
+    void*           tw_I;
+    void*           tw_stream;  // twiddles in the order the stages consume them (fft_sbg_radix_tw_stream_fill)
+    void*           tw_fast;    // same for the packets of the fast engine (SW = fft_sbg_radix_fast_width(SIZE))
+    sbg_scratch*    scratch;    // scratch used by sbg_plan_execute
+    sbg_prune*      prune;      // nullptr unless set by sbg_plan_set_pruning
+};
+
+const sbg_rom& lib_fft_sbg_radix_roms();
+
+/**
+ * @brief Create a plan for a SIZE points FFT
+ *
+ * @param SIZE  FFT size
+ * @param RADIX Core radix
+ * @param SW    Streaming width
+ * @param GROUP Number of stages per group
+ * @param types Numeric configuration
+ * @return sbg_plan* Plan to release with sbg_plan_destroy
+ */
+sbg_plan* sbg_plan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Select the engine of a plan. Both give the same results, SBG_ENGINE_VALIDATE checks it on every frame.
+ * To be called before the plan is executed.
+ */
+void sbg_plan_set_engine(sbg_plan* plan, const sbg_engine engine);
+
+/**
+ * @brief Select the direction of a plan. The inverse transform runs the forward datapath with the real and
+ * imaginary parts swapped at its input and output, IFFT(x) = swap(FFT(swap(x))), so that it keeps the same
+ * twiddles and throughput. The other plans and the fused convolution kernels use the same swap. With
+ * normalize, its outputs are scaled by 1/SIZE in the datapath format (util_scale), so that a forward then inverse
+ * transform gives the input back. To be called before the plan is executed.
+ */
+void sbg_plan_set_direction(sbg_plan* plan, const sbg_direction direction, const bool normalize = false);
+
+/**
+ * @brief Prune a plan : the input samples from valid onward are taken as zeros and only the bins first..last are
+ * written, so that the fast engine skips the packets whose inputs are all zero or whose outputs are never read. The
+ * bins outside first..last are left undefined. The model engine computes the whole transform, SBG_ENGINE_VALIDATE
+ * compares the bins first..last. Pruning with valid = SIZE and the bins 0..SIZE-1 restores the whole transform.
+ * To be called before the plan is executed.
+ *
+ * @param valid Number of leading input samples that may be non zero, 1..SIZE
+ * @param first First bin written
+ * @param last  Last bin written, first..SIZE-1
+ */
+void sbg_plan_set_pruning(sbg_plan* plan, const int32_t valid, const int32_t first, const int32_t last);
+
+/**
+ * @brief Compute one FFT frame with a plan. in and out buffers may alias.
+ */
+void sbg_plan_execute(sbg_plan* plan, const float* in_R, const float* in_I, float* out_R, float* out_I);
+
+/**
+ * @brief Compute count consecutive frames of plan->SIZE samples
+ */
+void sbg_plan_execute_batch(sbg_plan* plan, const float* in_R, const float* in_I, float* out_R, float* out_I, const int32_t count);
+
+/**
+ * @brief Compute count consecutive frames of a fixed point plan without leaving the datapath format
+ *
+ * Samples are the raw datapath values (q_input-2 fractional bits), so that the results are bit-accurate
+ * with the HLS datapath.
+ *
+ */
+void sbg_plan_execute_fixed(sbg_plan* plan, const int32_t* in_R, const int32_t* in_I, int32_t* out_R, int32_t* out_I, const int32_t count = 1);
+
+/**
+ * @brief Compute count consecutive frames of a double plan with double samples, so that the precision of the
+ * datapath is kept on the inputs and outputs
+ */
+void sbg_plan_execute_double(sbg_plan* plan, const double* in_R, const double* in_I, double* out_R, double* out_I, const int32_t count = 1);
+
+/**
+ * @brief Compute one windowed FFT frame read from a ring buffer (STFT)
+ *
+ * Sample n of the frame is ring[(start + n) & mask] : the frame may wrap around the end of the ring. It is multiplied
+ * by window[n] in the pass that converts the samples to the datapath format, so that neither the gather nor the
+ * window cost a pass of their own.
+ *
+ * @param ring_R Ring buffer (real), mask+1 samples, a power of two
+ * @param ring_I Ring buffer (imag)
+ * @param mask   Ring capacity minus one
+ * @param start  Position of the first sample of the frame in the ring
+ * @param window plan->SIZE coefficients
+ */
+void sbg_plan_execute_window(sbg_plan* plan, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const float* window, float* out_R, float* out_I);
+
+/**
+ * @brief Circular convolution of a frame read from a ring buffer with a cached spectrum (fast convolution)
+ *
+ * The count samples ring[(start + n) & mask] are zero padded to plan->SIZE, transformed, multiplied by H and
+ * transformed back. The product (cmult), scaled by 1/SIZE, is written by the pass that reads the forward result, in
+ * the swapped order of the inverse transform (see sbg_plan_set_direction), so that the spectrum never leaves the
+ * datapath format. The plan direction must be SBG_FORWARD.
+ *
+ * @param count Number of samples read from the ring, the frame is zero padded after them
+ * @param H     Spectrum of plan->SIZE bins, converted by sbg_spectrum_create
+ * @param skip  Number of leading output samples that are not written (the wrapped ones of an overlap-save block)
+ * @param out_R Output (real), plan->SIZE - skip samples
+ * @param out_I Output (imag)
+ */
+void sbg_plan_execute_conv(sbg_plan* plan, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const int32_t count, const sbg_spectrum* H, const int32_t skip, float* out_R, float* out_I);
+
+/**
+ * @brief Convert a spectrum to the twiddle format of a plan, quantified like the twiddles on the fixed point
+ * datapaths, so that sbg_plan_execute_conv reads it as is on every frame
+ *
+ * @param H_R Spectrum (real), plan->SIZE bins
+ * @param H_I Spectrum (imag)
+ * @return sbg_spectrum* Spectrum to release with sbg_spectrum_destroy
+ */
+sbg_spectrum* sbg_spectrum_create(const sbg_plan* plan, const float* H_R, const float* H_I);
+
+void sbg_spectrum_destroy(const sbg_plan* plan, sbg_spectrum* H);
+
+/**
+ * @brief Allocate an additional scratch for a plan, to execute it from another thread
+ */
+sbg_scratch* sbg_scratch_create(const sbg_plan* plan);
+
+void sbg_scratch_destroy(const sbg_plan* plan, sbg_scratch* scratch);
+
+/**
+ * @brief Compute one FFT frame with a plan and a caller-owned scratch. Concurrent calls on the same plan
+ * are safe as long as they use distinct scratches.
+ */
+void sbg_plan_execute_scratch(const sbg_plan* plan, sbg_scratch* scratch, const float* in_R, const float* in_I, float* out_R, float* out_I);
+
+void sbg_plan_destroy(sbg_plan* plan);
+
+#endif // LIB_FFT_SBG_RADIX_PLAN_HPP_
@@ -0,0 +1,110 @@
+/**
+ * @file lib_fft_sbg_radix_pool.cpp
+ * @brief This file contains the work-stealing thread pool used to spread independent FFTs across cores
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <algorithm>
+#include "lib_fft_sbg_radix_pool.hpp"
+
+sbg_pool::sbg_pool(const int32_t nthreads)
+    : queues( (nthreads > 0) ? nthreads : std::max(1u, std::thread::hardware_concurrency()) ),
+      job_task(nullptr), job_generation(0), job_busy(0), job_remaining(0), stopping(false)
+{
+    for(int32_t w = 1; w < size(); w++)
+        threads.emplace_back(&sbg_pool::worker_loop, this, w);
+}
+
+sbg_pool::~sbg_pool(){
+    {
+        std::lock_guard<std::mutex> guard(job_lock);
+        stopping = true;
+    }
+    job_start.notify_all();
+    for(auto& t : threads)
+        t.join();
+}
+
+bool sbg_pool::next_chunk(const int32_t worker, std::pair<int64_t, int64_t>& chunk){
+    {
+        chunk_queue& own = queues[worker];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if( !own.chunks.empty() ){
+            chunk = own.chunks.front();
+            own.chunks.pop_front();
+            return true;
+        }
+    }
+    // Own deque is empty : steal from the back of the others, starting with the next worker
+    for(int32_t i = 1; i < size(); i++){
+        chunk_queue& victim = queues[(worker + i) % size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if( !victim.chunks.empty() ){
+            chunk = victim.chunks.back();
+            victim.chunks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void sbg_pool::work(const int32_t worker){
+    std::pair<int64_t, int64_t> chunk;
+    while( (job_remaining.load(std::memory_order_acquire) > 0) && next_chunk(worker, chunk) ){
+        (*job_task)(worker, chunk.first, chunk.second);
+        job_remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+void sbg_pool::worker_loop(const int32_t worker){
+    uint64_t seen = 0;
+    while( true ){
+        {
+            std::unique_lock<std::mutex> guard(job_lock);
+            job_start.wait(guard, [&]{ return stopping || (job_generation != seen); });
+            if( stopping )
+                return;
+            seen = job_generation;
+        }
+        work(worker);
+        {
+            std::lock_guard<std::mutex> guard(job_lock);
+            job_busy -= 1;
+        }
+        job_done.notify_one();
+    }
+}
+
+void sbg_pool::parallel_for(const int64_t count, const int64_t grain, const task_t& task){
+    if( count <= 0 )
+        return;
+    const int64_t step = (grain > 0) ? grain : 1;
+
+    // Contiguous chunks are dealt in blocks, so that each worker starts on its own part of the data
+    const int64_t nchunks   = (count + step - 1) / step;
+    const int64_t per_queue = (nchunks + size() - 1) / size();
+    for(int64_t c = 0; c < nchunks; c++){
+        chunk_queue& q = queues[c / per_queue];
+        std::lock_guard<std::mutex> guard(q.lock);
+        q.chunks.emplace_back(c * step, std::min(count, (c + 1) * step));
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(job_lock);
+        job_task = &task;
+        job_remaining.store(nchunks, std::memory_order_release);
+        job_busy = size() - 1;
+        job_generation += 1;
+    }
+    job_start.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> guard(job_lock);
+    job_done.wait(guard, [&]{ return job_busy == 0; });
+    job_task = nullptr;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file lib_fft_sbg_radix_pool.hpp
+ * @brief This file contains the work-stealing thread pool used to spread independent FFTs across cores
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_POOL_HPP_
+#define LIB_FFT_SBG_RADIX_POOL_HPP_
+
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Each worker owns a deque of chunks of work. A worker takes its chunks from the front of its own deque and,
+ * once it is empty, steals from the back of the other deques, so that uneven chunks do not leave cores idle.
+ * The calling thread is worker 0, the pool owns the size()-1 other threads.
+ *
+ */
+class sbg_pool {
+public :
+    typedef std::function<void(const int32_t worker, const int64_t first, const int64_t last)> task_t;
+
+    /**
+     * @param nthreads Number of workers, the hardware concurrency when <= 0
+     */
+    explicit sbg_pool(const int32_t nthreads);
+    ~sbg_pool();
+
+    sbg_pool(const sbg_pool&) = delete;
+    sbg_pool& operator=(const sbg_pool&) = delete;
+
+    int32_t size() const {
+        return (int32_t) queues.size();
+    }
+
+    /**
+     * @brief Run task on every item of [0, count), by chunks of at most grain items, and wait for completion
+     *
+     * task is called as task(worker, first, last) with worker in [0, size()) : data indexed by worker
+     * (scratch buffers for instance) is never used by two threads at once.
+     *
+     */
+    void parallel_for(const int64_t count, const int64_t grain, const task_t& task);
+
+private :
+    struct chunk_queue {
+        std::mutex lock;
+        std::deque<std::pair<int64_t, int64_t>> chunks;
+    };
+
+    bool next_chunk(const int32_t worker, std::pair<int64_t, int64_t>& chunk);
+    void work(const int32_t worker);
+    void worker_loop(const int32_t worker);
+
+    std::vector<chunk_queue>  queues;
+    std::vector<std::thread>  threads;
+
+    std::mutex                job_lock;
+    std::condition_variable   job_start;
+    std::condition_variable   job_done;
+    const task_t*             job_task;
+    uint64_t                  job_generation;
+    int32_t                   job_busy;      // workers still running the current job
+    std::atomic<int64_t>      job_remaining; // chunks not processed yet
+    bool                      stopping;
+};
+
+#endif // LIB_FFT_SBG_RADIX_POOL_HPP_
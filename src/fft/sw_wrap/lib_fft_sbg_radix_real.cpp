@@ -0,0 +1,143 @@
+/**
+ * @file lib_fft_sbg_radix_real.cpp
+ * @brief This file contains the real input transforms built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "lib_fft_sbg_radix_real.hpp"
+#include "lib_fft_sbg_radix_batch.hpp"
+
+sbg_rplan* sbg_rplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    if( (SIZE < 4) || (SIZE % 4 != 0) ){
+        std::cout << "(EE) Error in sbg_rplan_create function, the real FFT size (" << SIZE << ") must be a multiple of 4 !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    const int32_t HALF = SIZE / 2;
+    sbg_rplan* rplan = new sbg_rplan();
+    rplan->SIZE = SIZE;
+    rplan->plan = sbg_plan_create(HALF, RADIX, SW, GROUP, types);
+    rplan->w_R  = new float[HALF/2 + 1];
+    rplan->w_I  = new float[HALF/2 + 1];
+    rplan->z_R  = new float[HALF];
+    rplan->z_I  = new float[HALF];
+    for(int k = 0; k <= HALF/2; k++){
+        rplan->w_R[k] =  std::cos(2.0 * M_PI * k / SIZE);
+        rplan->w_I[k] = -std::sin(2.0 * M_PI * k / SIZE);
+    }
+    return rplan;
+}
+
+/**
+ * @brief Split the transform Z of a packed frame into the SIZE/2+1 bins of the real spectrum
+ */
+static void sbg_rplan_split(const sbg_rplan* rplan, const float* z_R, const float* z_I, float* out_R, float* out_I){
+    const int32_t HALF = rplan->SIZE / 2;
+
+    out_R[0]    = z_R[0] + z_I[0];
+    out_I[0]    = 0.0f;
+    out_R[HALF] = z_R[0] - z_I[0];
+    out_I[HALF] = 0.0f;
+
+    // bins k and HALF-k from Z[k] and Z[HALF-k] : X[HALF-k] = conj(E[k] - W^k.O[k])
+    for(int k = 1; k <= HALF/2; k++){
+        const float a_R = z_R[k],        a_I = z_I[k];
+        const float b_R = z_R[HALF - k], b_I = -z_I[HALF - k];
+        const float e_R = 0.5f * (a_R + b_R);
+        const float e_I = 0.5f * (a_I + b_I);
+        const float o_R = 0.5f * (a_I - b_I);
+        const float o_I = 0.5f * (b_R - a_R);
+        const float t_R = rplan->w_R[k] * o_R - rplan->w_I[k] * o_I;
+        const float t_I = rplan->w_R[k] * o_I + rplan->w_I[k] * o_R;
+        out_R[k]        =   e_R + t_R;
+        out_I[k]        =   e_I + t_I;
+        out_R[HALF - k] =   e_R - t_R;
+        out_I[HALF - k] = -(e_I - t_I);
+    }
+}
+
+void sbg_rplan_execute(sbg_rplan* rplan, const float* in, float* out_R, float* out_I, const int32_t count, sbg_pool* pool){
+    const int32_t SIZE = rplan->SIZE;
+    const int32_t HALF = SIZE / 2;
+
+    if( (pool == nullptr) || (pool->size() == 1) ){
+        float* z_R = rplan->z_R;
+        float* z_I = rplan->z_I;
+        for(int f = 0; f < count; f++, in += SIZE, out_R += HALF + 1, out_I += HALF + 1){
+            for(int n = 0; n < HALF; n++){
+                z_R[n] = in[2*n];
+                z_I[n] = in[2*n + 1];
+            }
+            sbg_plan_execute(rplan->plan, z_R, z_I, z_R, z_I);
+            sbg_rplan_split(rplan, z_R, z_I, out_R, out_I);
+        }
+        return;
+    }
+
+    // every frame is packed first, so that the complex transforms run as one batch
+    std::vector<float> z_R((size_t) count * HALF), z_I((size_t) count * HALF);
+    for(size_t n = 0; n < z_R.size(); n++){
+        z_R[n] = in[2*n];
+        z_I[n] = in[2*n + 1];
+    }
+    const sbg_frames frames = {z_R.data(), z_I.data(), z_R.data(), z_I.data()};
+    sbg_batch_execute(rplan->plan, frames, count, *pool);
+    for(int f = 0; f < count; f++)
+        sbg_rplan_split(rplan, z_R.data() + (size_t) f*HALF, z_I.data() + (size_t) f*HALF, out_R + (size_t) f*(HALF + 1), out_I + (size_t) f*(HALF + 1));
+}
+
+void sbg_rplan_destroy(sbg_rplan* rplan){
+    if( rplan == nullptr )
+        return;
+    sbg_plan_destroy(rplan->plan);
+    delete[] rplan->w_R;
+    delete[] rplan->w_I;
+    delete[] rplan->z_R;
+    delete[] rplan->z_I;
+    delete rplan;
+}
+
+void sbg_plan_execute_real_pair(sbg_plan* plan, const float* x, const float* y, float* X_R, float* X_I, float* Y_R, float* Y_I, const int32_t count, sbg_pool* pool){
+    const int32_t SIZE = plan->SIZE;
+    const int32_t HALF = SIZE / 2;
+
+    // one frame at a time on a single thread, every frame at once as a batch otherwise
+    const bool serial = (pool == nullptr) || (pool->size() == 1);
+    const int32_t block = serial ? 1 : count;
+    std::vector<float> z_R((size_t) block * SIZE), z_I((size_t) block * SIZE);
+
+    for(int f0 = 0; f0 < count; f0 += block){
+        const sbg_frames frames = {x + (size_t) f0*SIZE, y + (size_t) f0*SIZE, z_R.data(), z_I.data()};
+        if( serial ){
+            sbg_plan_execute(plan, frames.in_R, frames.in_I, frames.out_R, frames.out_I);
+        }else{
+            sbg_batch_execute(plan, frames, block, *pool);
+        }
+
+        for(int b = 0; b < block; b++){
+            const int32_t f = f0 + b;
+            const float* zr = z_R.data() + (size_t) b*SIZE;
+            const float* zi = z_I.data() + (size_t) b*SIZE;
+            float* xr = X_R + (size_t) f*(HALF + 1);
+            float* xi = X_I + (size_t) f*(HALF + 1);
+            float* yr = Y_R + (size_t) f*(HALF + 1);
+            float* yi = Y_I + (size_t) f*(HALF + 1);
+            for(int k = 0; k <= HALF; k++){
+                const int32_t m = (SIZE - k) % SIZE;
+                xr[k] = 0.5f * (zr[k] + zr[m]);
+                xi[k] = 0.5f * (zi[k] - zi[m]);
+                yr[k] = 0.5f * (zi[k] + zi[m]);
+                yi[k] = 0.5f * (zr[m] - zr[k]);
+            }
+        }
+    }
+}
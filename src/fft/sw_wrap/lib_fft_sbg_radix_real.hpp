@@ -0,0 +1,78 @@
+/**
+ * @file lib_fft_sbg_radix_real.hpp
+ * @brief This file contains the real input transforms built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_REAL_HPP_
+#define LIB_FFT_SBG_RADIX_REAL_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "lib_fft_sbg_radix_pool.hpp"
+
+/**
+ * @brief Real input FFT plan
+ *
+ * The SIZE real samples x are packed as SIZE/2 complex samples z[n] = x[2n] + j.x[2n+1], transformed by a SIZE/2
+ * points plan, and the SIZE/2+1 bins X[k] = E[k] + W_SIZE^k.O[k] of the Hermitian spectrum are split from Z :
+ * E[k] = (Z[k] + conj(Z[SIZE/2-k]))/2 and O[k] = -j.(Z[k] - conj(Z[SIZE/2-k]))/2.
+ * The split runs on the float outputs of the complex plan, whatever its datapath.
+ *
+ */
+struct sbg_rplan {
+    int32_t         SIZE;       // real samples per frame
+    sbg_plan*       plan;       // SIZE/2 points complex plan
+    float*          w_R;        // W_SIZE^k, k <= SIZE/4
+    float*          w_I;
+    float*          z_R;        // packed frame, transformed in place
+    float*          z_I;
+};
+
+/**
+ * @brief Create a real input plan for a SIZE points FFT
+ *
+ * The loaded ROM must serve the SIZE/2 points complex plan (see sbg_plan_create).
+ *
+ * @param SIZE  Real FFT size
+ * @param RADIX Core radix of the SIZE/2 points plan
+ * @param SW    Streaming width of the SIZE/2 points plan
+ * @param GROUP Number of stages per group
+ * @param types Numeric configuration
+ * @return sbg_rplan* Plan to release with sbg_rplan_destroy
+ */
+sbg_rplan* sbg_rplan_create(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Compute count consecutive real frames of SIZE samples, each giving SIZE/2+1 bins (from 0 to SIZE/2)
+ *
+ * With a pool, the packed frames are transformed as one batch spread over its workers (see sbg_batch_execute),
+ * the results do not depend on the number of threads.
+ */
+void sbg_rplan_execute(sbg_rplan* rplan, const float* in, float* out_R, float* out_I, const int32_t count = 1, sbg_pool* pool = nullptr);
+
+void sbg_rplan_destroy(sbg_rplan* rplan);
+
+/**
+ * @brief Compute the spectra of two real signals of plan->SIZE samples with one complex FFT
+ *
+ * Z = FFT(x + j.y), then X[k] = (Z[k] + conj(Z[SIZE-k]))/2 and Y[k] = -j.(Z[k] - conj(Z[SIZE-k]))/2. Each spectrum
+ * is given as its SIZE/2+1 first bins.
+ *
+ * @param plan  SIZE points complex plan
+ * @param x     First real signal
+ * @param y     Second real signal
+ * @param X_R   Spectrum of x (real), SIZE/2+1 bins per frame
+ * @param X_I   Spectrum of x (imag)
+ * @param Y_R   Spectrum of y (real)
+ * @param Y_I   Spectrum of y (imag)
+ * @param count Number of consecutive frame pairs
+ * @param pool  Workers of the complex transforms (see sbg_batch_execute), nullptr to run them on the calling thread
+ */
+void sbg_plan_execute_real_pair(sbg_plan* plan, const float* x, const float* y, float* X_R, float* X_I, float* Y_R, float* Y_I, const int32_t count = 1, sbg_pool* pool = nullptr);
+
+#endif // LIB_FFT_SBG_RADIX_REAL_HPP_
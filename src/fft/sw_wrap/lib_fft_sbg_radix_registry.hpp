@@ -0,0 +1,836 @@
+/**
+ * @file lib_fft_sbg_radix_registry.hpp
+ * @brief This file contains the compile-time registry of the sbg_radix_fft instantiations used by the plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_REGISTRY_HPP_
+#define LIB_FFT_SBG_RADIX_REGISTRY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+#include "lib_fft_sbg_radix_plan.hpp"
+#include "../module/fft_sbg_radix.hpp"
+#include "../../common/fast_fixed.hpp"
+#include "ap_int.h"
+
+/**
+ * @brief List of the instantiated (SIZE, RADIX, SW) configurations
+ *
+ * Adding a configuration only requires a new line here, its permutation configurations are generated.
+ * SIZE needs not be a power of RADIX : the last stage then uses the tail radix SIZE/RADIX^(M-1) (mixed radix plan).
+ * Each configuration is instantiated for every group of sbg_radix_groups and every datapath type.
+ *
+ */
+#define SBG_RADIX_CONFIGS(CONFIG) \
+    CONFIG(   16, 2, 2) \
+    CONFIG(   32, 2, 2) \
+    CONFIG(   64, 2, 2) \
+    CONFIG(  128, 2, 2) \
+    CONFIG(  256, 2, 2) \
+    CONFIG(  512, 2, 2) \
+    CONFIG( 1024, 2, 2) \
+    CONFIG( 2048, 2, 2) \
+    CONFIG( 4096, 2, 2) \
+    CONFIG( 8192, 2, 2) \
+    CONFIG(16384, 2, 2) \
+    CONFIG(32768, 2, 2) \
+    CONFIG(65536, 2, 2) \
+    CONFIG(   16, 2, 4) \
+    CONFIG(   32, 2, 4) \
+    CONFIG(   64, 2, 4) \
+    CONFIG(  128, 2, 4) \
+    CONFIG(  256, 2, 4) \
+    CONFIG(  512, 2, 4) \
+    CONFIG( 1024, 2, 4) \
+    CONFIG( 2048, 2, 4) \
+    CONFIG( 4096, 2, 4) \
+    CONFIG( 8192, 2, 4) \
+    CONFIG(16384, 2, 4) \
+    CONFIG(32768, 2, 4) \
+    CONFIG(65536, 2, 4) \
+    CONFIG(   16, 2, 8) \
+    CONFIG(   32, 2, 8) \
+    CONFIG(   64, 2, 8) \
+    CONFIG(  128, 2, 8) \
+    CONFIG(  256, 2, 8) \
+    CONFIG(  512, 2, 8) \
+    CONFIG( 1024, 2, 8) \
+    CONFIG( 2048, 2, 8) \
+    CONFIG( 4096, 2, 8) \
+    CONFIG( 8192, 2, 8) \
+    CONFIG(16384, 2, 8) \
+    CONFIG(32768, 2, 8) \
+    CONFIG(65536, 2, 8) \
+    CONFIG(   16, 4, 4) \
+    CONFIG(   64, 4, 4) \
+    CONFIG(  256, 4, 4) \
+    CONFIG( 1024, 4, 4) \
+    CONFIG( 4096, 4, 4) \
+    CONFIG(16384, 4, 4) \
+    CONFIG(65536, 4, 4) \
+    CONFIG(   32, 4, 4) \
+    CONFIG(  128, 4, 4) \
+    CONFIG(  512, 4, 4) \
+    CONFIG( 2048, 4, 4) \
+    CONFIG( 8192, 4, 4) \
+    CONFIG(32768, 4, 4) \
+    CONFIG(   16, 4, 8) \
+    CONFIG(   64, 4, 8) \
+    CONFIG(  256, 4, 8) \
+    CONFIG( 1024, 4, 8) \
+    CONFIG( 4096, 4, 8) \
+    CONFIG(16384, 4, 8) \
+    CONFIG(65536, 4, 8) \
+    CONFIG(   32, 4, 8) \
+    CONFIG(  128, 4, 8) \
+    CONFIG(  512, 4, 8) \
+    CONFIG( 2048, 4, 8) \
+    CONFIG( 8192, 4, 8) \
+    CONFIG(32768, 4, 8) \
+    CONFIG(   64, 8, 8) \
+    CONFIG(  512, 8, 8) \
+    CONFIG( 4096, 8, 8) \
+    CONFIG(32768, 8, 8) \
+    CONFIG(  128, 8, 8) \
+    CONFIG(  256, 8, 8) \
+    CONFIG( 1024, 8, 8) \
+    CONFIG( 2048, 8, 8) \
+    CONFIG( 8192, 8, 8) \
+    CONFIG(16384, 8, 8) \
+    CONFIG(65536, 8, 8) \
+    CONFIG(  256, 16, 16) \
+    CONFIG(  512, 16, 16) \
+    CONFIG( 1024, 16, 16) \
+    CONFIG( 2048, 16, 16) \
+    CONFIG( 4096, 16, 16) \
+    CONFIG( 8192, 16, 16) \
+    CONFIG(16384, 16, 16) \
+    CONFIG(32768, 16, 16) \
+    CONFIG(65536, 16, 16) \
+    CONFIG(  256, 2, 16) \
+    CONFIG(  512, 2, 16) \
+    CONFIG( 1024, 2, 16) \
+    CONFIG( 2048, 2, 16) \
+    CONFIG( 4096, 2, 16) \
+    CONFIG( 8192, 2, 16) \
+    CONFIG(16384, 2, 16) \
+    CONFIG(32768, 2, 16) \
+    CONFIG(65536, 2, 16) \
+    CONFIG(  256, 2, 32) \
+    CONFIG(  512, 2, 32) \
+    CONFIG( 1024, 2, 32) \
+    CONFIG( 2048, 2, 32) \
+    CONFIG( 4096, 2, 32) \
+    CONFIG( 8192, 2, 32) \
+    CONFIG(16384, 2, 32) \
+    CONFIG(32768, 2, 32) \
+    CONFIG(65536, 2, 32) \
+    CONFIG(  256, 4, 16) \
+    CONFIG(  512, 4, 16) \
+    CONFIG( 1024, 4, 16) \
+    CONFIG( 2048, 4, 16) \
+    CONFIG( 4096, 4, 16) \
+    CONFIG( 8192, 4, 16) \
+    CONFIG(16384, 4, 16) \
+    CONFIG(32768, 4, 16) \
+    CONFIG(65536, 4, 16) \
+    CONFIG(  256, 4, 32) \
+    CONFIG(  512, 4, 32) \
+    CONFIG( 1024, 4, 32) \
+    CONFIG( 2048, 4, 32) \
+    CONFIG( 4096, 4, 32) \
+    CONFIG( 8192, 4, 32) \
+    CONFIG(16384, 4, 32) \
+    CONFIG(32768, 4, 32) \
+    CONFIG(65536, 4, 32) \
+    CONFIG(  256, 8, 16) \
+    CONFIG(  512, 8, 16) \
+    CONFIG( 1024, 8, 16) \
+    CONFIG( 2048, 8, 16) \
+    CONFIG( 4096, 8, 16) \
+    CONFIG( 8192, 8, 16) \
+    CONFIG(16384, 8, 16) \
+    CONFIG(32768, 8, 16) \
+    CONFIG(65536, 8, 16) \
+    CONFIG(  256, 8, 32) \
+    CONFIG(  512, 8, 32) \
+    CONFIG( 1024, 8, 32) \
+    CONFIG( 2048, 8, 32) \
+    CONFIG( 4096, 8, 32) \
+    CONFIG( 8192, 8, 32) \
+    CONFIG(16384, 8, 32) \
+    CONFIG(32768, 8, 32) \
+    CONFIG(65536, 8, 32) \
+    CONFIG(  256, 16, 32) \
+    CONFIG(  512, 16, 32) \
+    CONFIG( 1024, 16, 32) \
+    CONFIG( 2048, 16, 32) \
+    CONFIG( 4096, 16, 32) \
+    CONFIG( 8192, 16, 32) \
+    CONFIG(16384, 16, 32) \
+    CONFIG(32768, 16, 32) \
+    CONFIG(65536, 16, 32)
+
+constexpr int sbg_radix_groups[] = { 2 };
+
+struct sbg_config_key {
+    int SIZE;
+    int RADIX;
+    int SW;
+};
+
+#define SBG_CONFIG_KEY(N, R, S) { N, R, S },
+constexpr sbg_config_key sbg_radix_configs[] = { SBG_RADIX_CONFIGS(SBG_CONFIG_KEY) };
+#undef SBG_CONFIG_KEY
+
+constexpr int SBG_REGISTRY_NUM_CONFIGS = sizeof(sbg_radix_configs) / sizeof(sbg_config_key);
+constexpr int SBG_REGISTRY_NUM_GROUPS  = sizeof(sbg_radix_groups)  / sizeof(int);
+
+/**
+ * @brief Permutation configurations of a (SIZE, RADIX, SW) configuration, generated at compile time
+ */
+template<int SIZE, int RADIX, int SW>
+struct sbg_perm_traits {
+    typedef dig_rev_perm<SIZE, SW, RADIX> dig_rev_t;
+    typedef stride_perm<SIZE, SW, RADIX>  stride_t;
+    typedef stride_perm<SIZE, SW, fft_sbg_radix_tail_radix(SIZE, RADIX)> tail_stride_t; // last stage of a mixed radix plan
+
+    static constexpr int DIGIT_REV_NUM_STAGE          = dig_rev_t::NUM_STAGE;
+    static constexpr int STRIDE_PERM_SWITCH_NUM_STAGE = stride_t::NUM_STAGE;
+
+    static constexpr typename dig_rev_t::config_t dig_rev_config(){
+        return dig_rev_t::config();
+    }
+    static constexpr typename stride_t::config_t stride_config(){
+        return stride_t::config();
+    }
+    static constexpr typename tail_stride_t::config_t tail_stride_config(){
+        return tail_stride_t::config();
+    }
+};
+
+/**
+ * @brief C++ types of a datapath
+ */
+template<sbg_dtype DT>
+struct sbg_dtype_traits;
+
+template<>
+struct sbg_dtype_traits<SBG_DTYPE_FLOAT> {
+    typedef float DTYPE;
+    typedef float TTYPE;
+    typedef float ITYPE;
+};
+
+template<>
+struct sbg_dtype_traits<SBG_DTYPE_FIXED> {
+    typedef ap_int<32> DTYPE;
+    typedef ap_int<32> TTYPE;
+    typedef ap_int<64> ITYPE;
+};
+
+template<>
+struct sbg_dtype_traits<SBG_DTYPE_FAST_FIXED> {
+    typedef fast_fixed<32> DTYPE;
+    typedef fast_fixed<32> TTYPE;
+    typedef fast_fixed<64> ITYPE;
+};
+
+template<>
+struct sbg_dtype_traits<SBG_DTYPE_DOUBLE> {
+    typedef double DTYPE;
+    typedef double TTYPE;
+    typedef double ITYPE;
+};
+
+
+template<int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE, int SW, int LOG2N, int LOG2SW>
+struct sbg_plan_configs {
+    perm_config<DIGIT_REV_NUM_STAGE, SW, LOG2N, LOG2SW>          dig_rev;
+    perm_config<STRIDE_PERM_SWITCH_NUM_STAGE, SW, LOG2N, LOG2SW> stride;
+    fft_sbg_radix_perm_table<(1 << LOG2N), SW>                   dig_rev_table; // compiled forms used by the software model
+    fft_sbg_radix_perm_table<(1 << LOG2N), SW>                   stride_table;
+    fft_sbg_radix_perm_table<(1 << LOG2N), SW>                   tail_stride_table;
+    int32_t                                                      dig_rev_index[1 << LOG2N]; // fast engine
+};
+
+//
+// Conversion of the user samples to the datapath format and back
+//
+
+template<class IOTYPE, class FTYPE>
+inline void sbg_plan_load_float(const sbg_plan* plan, const IOTYPE* in, FTYPE* buf){
+    if( plan->types.q_input == 0 ){
+        for(int i = 0; i < plan->SIZE; i++)
+            buf[i] = in[i];
+    }else{
+        const uint8_t Q_in = plan->types.q_input;
+        for(int i = 0; i < plan->SIZE; i++)
+            buf[i] = std::round(in[i]*(1 << (Q_in-1)));
+    }
+}
+
+template<class FTYPE, class IOTYPE>
+inline void sbg_plan_store_float(const sbg_plan* plan, const FTYPE* buf, IOTYPE* out){
+    if( plan->types.q_input == 0 ){
+        for(int i = 0; i < plan->SIZE; i++)
+            out[i] = buf[i];
+    }else{
+        const uint8_t Q_in = plan->types.q_input;
+        for(int i = 0; i < plan->SIZE; i++)
+            out[i] = buf[i]/(1<<(Q_in-1));
+    }
+}
+
+inline void sbg_plan_load(const sbg_plan* plan, const float* in, float* buf){
+    sbg_plan_load_float(plan, in, buf);
+}
+
+inline void sbg_plan_store(const sbg_plan* plan, const float* buf, float* out){
+    sbg_plan_store_float(plan, buf, out);
+}
+
+inline void sbg_plan_load(const sbg_plan* plan, const float* in, double* buf){
+    sbg_plan_load_float(plan, in, buf);
+}
+
+inline void sbg_plan_store(const sbg_plan* plan, const double* buf, float* out){
+    sbg_plan_store_float(plan, buf, out);
+}
+
+template<class DTYPE>
+inline void sbg_plan_load(const sbg_plan* plan, const float* in, DTYPE* buf){
+    const uint8_t Q_in = plan->types.q_input-2;
+    for(int i = 0; i < plan->SIZE; i++)
+        buf[i] = in[i] * (((DTYPE) 1) << Q_in);
+}
+
+template<class DTYPE>
+inline void sbg_plan_store(const sbg_plan* plan, const DTYPE* buf, float* out){
+    const uint8_t Q_in = plan->types.q_input-2;
+    for(int i = 0; i < plan->SIZE; i++)
+        out[i] = ((double) buf[i]) / (((DTYPE) 1) << Q_in);
+}
+
+//
+// Same conversions for the windowed frames read from a ring buffer (sbg_plan_execute_window)
+//
+
+template<class FTYPE>
+inline void sbg_plan_load_window_float(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const float* window, FTYPE* buf){
+    if( plan->types.q_input == 0 ){
+        for(int i = 0; i < plan->SIZE; i++)
+            buf[i] = ring[(start + i) & mask] * window[i];
+    }else{
+        const uint8_t Q_in = plan->types.q_input;
+        for(int i = 0; i < plan->SIZE; i++)
+            buf[i] = std::round(ring[(start + i) & mask] * window[i] * (1 << (Q_in-1)));
+    }
+}
+
+inline void sbg_plan_load_window(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const float* window, float* buf){
+    sbg_plan_load_window_float(plan, ring, mask, start, window, buf);
+}
+
+inline void sbg_plan_load_window(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const float* window, double* buf){
+    sbg_plan_load_window_float(plan, ring, mask, start, window, buf);
+}
+
+template<class DTYPE>
+inline void sbg_plan_load_window(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const float* window, DTYPE* buf){
+    const uint8_t Q_in = plan->types.q_input-2;
+    for(int i = 0; i < plan->SIZE; i++)
+        buf[i] = ring[(start + i) & mask] * window[i] * (((DTYPE) 1) << Q_in);
+}
+
+//
+// Twiddles are taken from the loaded ROM, decimated when the ROM is larger than the plan
+//
+
+inline void sbg_plan_twiddles(const sbg_plan* plan, float* tw_R, float* tw_I){
+    const sbg_rom& rom = lib_fft_sbg_radix_roms();
+    const int32_t step = rom.SIZE / plan->SIZE;
+    for(int i = 0; i < plan->SIZE; i++){
+        tw_R[i] = rom.cos[i*step];
+        tw_I[i] = rom.sin[i*step];
+    }
+}
+
+inline void sbg_plan_twiddles(const sbg_plan* plan, double* tw_R, double* tw_I){
+    const sbg_rom& rom = lib_fft_sbg_radix_roms();
+    const int32_t step = rom.SIZE / plan->SIZE;
+    for(int i = 0; i < plan->SIZE; i++){
+        tw_R[i] = rom.cos_double[i*step];
+        tw_I[i] = rom.sin_double[i*step];
+    }
+}
+
+template<class TTYPE>
+inline void sbg_plan_twiddles(const sbg_plan* plan, TTYPE* tw_R, TTYPE* tw_I){
+    const sbg_rom& rom = lib_fft_sbg_radix_roms();
+    const int32_t step = rom.SIZE / plan->SIZE;
+    for(int i = 0; i < plan->SIZE; i++){
+        tw_R[i] = rom.cos_fixed[i*step];
+        tw_I[i] = rom.sin_fixed[i*step];
+    }
+}
+
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_transform(const sbg_plan* plan, sbg_scratch* scratch){
+    typedef sbg_plan_configs<DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE, SW, ceillog2(SIZE), ceillog2(SW)> configs_t;
+    typedef sbg_radix_ctx<DTYPE, SIZE, RADIX, SW> context_t;
+    configs_t* configs = (configs_t*) plan->configs;
+    context_t& context = *(context_t*) scratch->context;
+
+    // inverse transform, see sbg_plan_set_direction
+    const bool inverse = (plan->direction == SBG_INVERSE);
+    const DTYPE* in_R  = (const DTYPE*) (inverse ? scratch->buf_in_I : scratch->buf_in_R);
+    const DTYPE* in_I  = (const DTYPE*) (inverse ? scratch->buf_in_R : scratch->buf_in_I);
+    DTYPE* out_R = (DTYPE*) (inverse ? scratch->buf_out_I : scratch->buf_out_R);
+    DTYPE* out_I = (DTYPE*) (inverse ? scratch->buf_out_R : scratch->buf_out_I);
+
+    // pruned transform : the known zero samples are zeroed, the fast engine skips the packets of its masks
+    const sbg_prune* prune = plan->prune;
+    int32_t first = 0, last = SIZE-1;
+    if( prune != nullptr ){
+        for(int i = prune->valid; i < SIZE; i++){
+            ((DTYPE*) scratch->buf_in_R)[i] = 0;
+            ((DTYPE*) scratch->buf_in_I)[i] = 0;
+        }
+        first = prune->first;
+        last  = prune->last;
+    }
+
+    if( plan->engine == SBG_ENGINE_MODEL ){
+        sbg_radix_fft_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(in_R, in_I, out_R, out_I, (const TTYPE*) plan->tw_stream, configs->dig_rev_table, configs->stride_table, configs->tail_stride_table, plan->Q, context);
+    }else{
+        sbg_radix_fft_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(in_R, in_I, out_R, out_I, (const TTYPE*) plan->tw_fast, configs->dig_rev_index, plan->Q, context, (prune != nullptr) ? prune->masks : nullptr);
+    }
+
+    if( plan->engine == SBG_ENGINE_VALIDATE ){
+        std::vector<DTYPE> model_R(SIZE), model_I(SIZE);
+        sbg_radix_fft_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(in_R, in_I, model_R.data(), model_I.data(), (const TTYPE*) plan->tw_stream, configs->dig_rev_table, configs->stride_table, configs->tail_stride_table, plan->Q, context);
+        for(int i = first; i <= last; i++){
+            if( !(out_R[i] == model_R[i]) || !(out_I[i] == model_I[i]) ){
+                std::cout << "(EE) Error in sbg_plan_transform function, the fast engine differs from the model !" << std::endl;
+                std::cout << "(EE) bin   = " << i << std::endl;
+                std::cout << "(EE) fast  = (" << (double) out_R[i]   << ", " << (double) out_I[i]   << ")" << std::endl;
+                std::cout << "(EE) model = (" << (double) model_R[i] << ", " << (double) model_I[i] << ")" << std::endl;
+                exit( EXIT_FAILURE );
+            }
+        }
+    }
+
+    if( inverse && plan->normalize ){
+        for(int i = 0; i < SIZE; i++){
+            out_R[i] = util_scale(out_R[i], ceillog2(SIZE));
+            out_I[i] = util_scale(out_I[i], ceillog2(SIZE));
+        }
+    }
+}
+
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_kernel_impl(const sbg_plan* plan, sbg_scratch* scratch, const float* in_R, const float* in_I, float* out_R, float* out_I){
+    sbg_plan_load(plan, in_R, (DTYPE*) scratch->buf_in_R);
+    sbg_plan_load(plan, in_I, (DTYPE*) scratch->buf_in_I);
+
+    sbg_plan_transform<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(plan, scratch);
+
+    sbg_plan_store(plan, (DTYPE*) scratch->buf_out_R, out_R);
+    sbg_plan_store(plan, (DTYPE*) scratch->buf_out_I, out_I);
+}
+
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_window_kernel_impl(const sbg_plan* plan, sbg_scratch* scratch, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const float* window, float* out_R, float* out_I){
+    sbg_plan_load_window(plan, ring_R, mask, start, window, (DTYPE*) scratch->buf_in_R);
+    sbg_plan_load_window(plan, ring_I, mask, start, window, (DTYPE*) scratch->buf_in_I);
+
+    sbg_plan_transform<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(plan, scratch);
+
+    sbg_plan_store(plan, (DTYPE*) scratch->buf_out_R, out_R);
+    sbg_plan_store(plan, (DTYPE*) scratch->buf_out_I, out_I);
+}
+
+/**
+ * @brief Raw fixed point I/O : samples are given and returned in the datapath format (q_input-2 fractional bits)
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_fixed_kernel_impl(const sbg_plan* plan, sbg_scratch* scratch, const int32_t* in_R, const int32_t* in_I, int32_t* out_R, int32_t* out_I){
+    DTYPE* buf_in_R  = (DTYPE*) scratch->buf_in_R;
+    DTYPE* buf_in_I  = (DTYPE*) scratch->buf_in_I;
+    DTYPE* buf_out_R = (DTYPE*) scratch->buf_out_R;
+    DTYPE* buf_out_I = (DTYPE*) scratch->buf_out_I;
+
+    for(int i = 0; i < SIZE; i++){
+        buf_in_R[i] = in_R[i];
+        buf_in_I[i] = in_I[i];
+    }
+
+    sbg_plan_transform<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(plan, scratch);
+
+    for(int i = 0; i < SIZE; i++){
+        out_R[i] = (int32_t) buf_out_R[i];
+        out_I[i] = (int32_t) buf_out_I[i];
+    }
+}
+
+template<sbg_dtype DT>
+struct sbg_plan_fixed_io {
+    template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+    static sbg_plan_fixed_kernel kernel(){
+        return nullptr;
+    }
+};
+
+template<>
+struct sbg_plan_fixed_io<SBG_DTYPE_FIXED> {
+    template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+    static sbg_plan_fixed_kernel kernel(){
+        return &sbg_plan_fixed_kernel_impl<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>;
+    }
+};
+
+template<>
+struct sbg_plan_fixed_io<SBG_DTYPE_FAST_FIXED> : sbg_plan_fixed_io<SBG_DTYPE_FIXED> {};
+
+/**
+ * @brief Double I/O : the samples of the double datapath do not go through float
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_double_kernel_impl(const sbg_plan* plan, sbg_scratch* scratch, const double* in_R, const double* in_I, double* out_R, double* out_I){
+    sbg_plan_load_float(plan, in_R, (DTYPE*) scratch->buf_in_R);
+    sbg_plan_load_float(plan, in_I, (DTYPE*) scratch->buf_in_I);
+
+    sbg_plan_transform<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>(plan, scratch);
+
+    sbg_plan_store_float(plan, (DTYPE*) scratch->buf_out_R, out_R);
+    sbg_plan_store_float(plan, (DTYPE*) scratch->buf_out_I, out_I);
+}
+
+template<sbg_dtype DT>
+struct sbg_plan_double_io {
+    template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+    static sbg_plan_double_kernel kernel(){
+        return nullptr;
+    }
+};
+
+template<>
+struct sbg_plan_double_io<SBG_DTYPE_DOUBLE> {
+    template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+    static sbg_plan_double_kernel kernel(){
+        return &sbg_plan_double_kernel_impl<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE>;
+    }
+};
+
+//
+// Same conversions for the frames of a fast convolution, count samples read from a ring buffer and zero padded,
+// and for the cached filter spectrum, converted to the twiddle format of the datapath
+//
+
+template<class FTYPE>
+inline void sbg_plan_load_ring_float(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const int32_t count, FTYPE* buf){
+    if( plan->types.q_input == 0 ){
+        for(int i = 0; i < count; i++)
+            buf[i] = ring[(start + i) & mask];
+    }else{
+        const uint8_t Q_in = plan->types.q_input;
+        for(int i = 0; i < count; i++)
+            buf[i] = std::round(ring[(start + i) & mask] * (1 << (Q_in-1)));
+    }
+    for(int i = count; i < plan->SIZE; i++)
+        buf[i] = 0;
+}
+
+inline void sbg_plan_load_ring(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const int32_t count, float* buf){
+    sbg_plan_load_ring_float(plan, ring, mask, start, count, buf);
+}
+
+inline void sbg_plan_load_ring(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const int32_t count, double* buf){
+    sbg_plan_load_ring_float(plan, ring, mask, start, count, buf);
+}
+
+template<class DTYPE>
+inline void sbg_plan_load_ring(const sbg_plan* plan, const float* ring, const int32_t mask, const int32_t start, const int32_t count, DTYPE* buf){
+    const uint8_t Q_in = plan->types.q_input-2;
+    for(int i = 0; i < count; i++)
+        buf[i] = ring[(start + i) & mask] * (((DTYPE) 1) << Q_in);
+    for(int i = count; i < plan->SIZE; i++)
+        buf[i] = 0;
+}
+
+template<class FTYPE>
+inline void sbg_plan_store_ring_float(const sbg_plan* plan, const FTYPE* buf, const int32_t skip, float* out){
+    const FTYPE Q_in = (plan->types.q_input == 0) ? 1 : (1 << (plan->types.q_input-1));
+    for(int i = skip; i < plan->SIZE; i++)
+        out[i - skip] = buf[i] / Q_in;
+}
+
+inline void sbg_plan_store_ring(const sbg_plan* plan, const float* buf, const int32_t skip, float* out){
+    sbg_plan_store_ring_float(plan, buf, skip, out);
+}
+
+inline void sbg_plan_store_ring(const sbg_plan* plan, const double* buf, const int32_t skip, float* out){
+    sbg_plan_store_ring_float(plan, buf, skip, out);
+}
+
+template<class DTYPE>
+inline void sbg_plan_store_ring(const sbg_plan* plan, const DTYPE* buf, const int32_t skip, float* out){
+    const uint8_t Q_in = plan->types.q_input-2;
+    for(int i = skip; i < plan->SIZE; i++)
+        out[i - skip] = ((double) buf[i]) / (((DTYPE) 1) << Q_in);
+}
+
+inline void sbg_plan_spectrum_fill(const sbg_plan* plan, const float* H, float* out){
+    std::copy(H, H + plan->SIZE, out);
+}
+
+inline void sbg_plan_spectrum_fill(const sbg_plan* plan, const float* H, double* out){
+    std::copy(H, H + plan->SIZE, out);
+}
+
+template<class TTYPE>
+inline void sbg_plan_spectrum_fill(const sbg_plan* plan, const float* H, TTYPE* out){
+    for(int i = 0; i < plan->SIZE; i++)
+        out[i] = TTYPE((int64_t) std::round(((double) H[i]) * (((int64_t) 1) << plan->Q)));
+}
+
+template<class TTYPE>
+sbg_spectrum* sbg_plan_spectrum_create(const sbg_plan* plan, const float* H_R, const float* H_I){
+    sbg_spectrum* H = new sbg_spectrum;
+    TTYPE* R = new TTYPE[plan->SIZE];
+    TTYPE* I = new TTYPE[plan->SIZE];
+    sbg_plan_spectrum_fill(plan, H_R, R);
+    sbg_plan_spectrum_fill(plan, H_I, I);
+    H->R = R;
+    H->I = I;
+    return H;
+}
+
+template<class TTYPE>
+void sbg_plan_spectrum_release(sbg_spectrum* H){
+    delete[] (TTYPE*) H->R;
+    delete[] (TTYPE*) H->I;
+    delete H;
+}
+
+/**
+ * @brief Fast convolution of a ring frame : forward transform, spectrum product (cmult) scaled by 1/SIZE and written
+ * swapped by the input pass of the inverse transform, inverse transform (sbg_radix_fft_conv_sw, sbg_radix_fft_conv_fast)
+ *
+ * The frame is converted in buf_in, the result overwrites it. The spectrum is read as converted by sbg_spectrum_create.
+ */
+template<class DTYPE, class TTYPE, class ITYPE, int SIZE, int RADIX, int SW, int GROUP, int DIGIT_REV_NUM_STAGE, int STRIDE_PERM_SWITCH_NUM_STAGE>
+void sbg_plan_conv_kernel_impl(const sbg_plan* plan, sbg_scratch* scratch, const float* ring_R, const float* ring_I, const int32_t mask, const int32_t start, const int32_t count, const sbg_spectrum* H, const int32_t skip, float* out_R, float* out_I){
+    typedef sbg_plan_configs<DIGIT_REV_NUM_STAGE, STRIDE_PERM_SWITCH_NUM_STAGE, SW, ceillog2(SIZE), ceillog2(SW)> configs_t;
+    typedef sbg_radix_ctx<DTYPE, SIZE, RADIX, SW> context_t;
+    configs_t* configs = (configs_t*) plan->configs;
+    context_t& context = *(context_t*) scratch->context;
+    DTYPE* buf_R = (DTYPE*) scratch->buf_in_R;
+    DTYPE* buf_I = (DTYPE*) scratch->buf_in_I;
+
+    sbg_plan_load_ring(plan, ring_R, mask, start, count, buf_R);
+    sbg_plan_load_ring(plan, ring_I, mask, start, count, buf_I);
+    const TTYPE* flt_R = (const TTYPE*) H->R;
+    const TTYPE* flt_I = (const TTYPE*) H->I;
+
+    if( plan->engine == SBG_ENGINE_MODEL ){
+        sbg_radix_fft_conv_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, flt_R, flt_I, buf_R, buf_I, (const TTYPE*) plan->tw_stream, configs->dig_rev_table, configs->stride_table, configs->tail_stride_table, plan->Q, context);
+    }else if( plan->engine == SBG_ENGINE_VALIDATE ){
+        std::vector<DTYPE> model_R(SIZE), model_I(SIZE);
+        sbg_radix_fft_conv_sw<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, flt_R, flt_I, model_R.data(), model_I.data(), (const TTYPE*) plan->tw_stream, configs->dig_rev_table, configs->stride_table, configs->tail_stride_table, plan->Q, context);
+        sbg_radix_fft_conv_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, flt_R, flt_I, buf_R, buf_I, (const TTYPE*) plan->tw_fast, configs->dig_rev_index, plan->Q, context);
+        for(int i = skip; i < SIZE; i++){
+            if( !(buf_R[i] == model_R[i]) || !(buf_I[i] == model_I[i]) ){
+                std::cout << "(EE) Error in sbg_plan_conv_kernel_impl function, the fast engine differs from the model !" << std::endl;
+                std::cout << "(EE) sample = " << i << std::endl;
+                std::cout << "(EE) fast   = (" << (double) buf_R[i]   << ", " << (double) buf_I[i]   << ")" << std::endl;
+                std::cout << "(EE) model  = (" << (double) model_R[i] << ", " << (double) model_I[i] << ")" << std::endl;
+                exit( EXIT_FAILURE );
+            }
+        }
+    }else{
+        sbg_radix_fft_conv_fast<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW>(buf_R, buf_I, flt_R, flt_I, buf_R, buf_I, (const TTYPE*) plan->tw_fast, configs->dig_rev_index, plan->Q, context);
+    }
+
+    sbg_plan_store_ring(plan, buf_R, skip, out_R);
+    sbg_plan_store_ring(plan, buf_I, skip, out_I);
+}
+
+template<int SIZE, int RADIX, class CONFIGS>
+void sbg_plan_prune_fill(const sbg_plan* plan, sbg_prune* prune){
+    const CONFIGS* configs = (const CONFIGS*) plan->configs;
+    prune->packets  = ceillogR(SIZE, RADIX) * (SIZE / fft_sbg_radix_fast_width(SIZE));
+    prune->masks    = new uint8_t[prune->packets];
+    prune->computed = fft_sbg_radix_prune_fill<SIZE, RADIX>(configs->dig_rev_index, prune->valid, prune->first, prune->last, prune->masks);
+}
+
+template<class TTYPE, class CONFIGS>
+void sbg_plan_release(sbg_plan* plan){
+    delete   (CONFIGS*) plan->configs;
+    delete[] (TTYPE*) plan->tw_R;
+    delete[] (TTYPE*) plan->tw_I;
+    delete[] (TTYPE*) plan->tw_stream;
+    delete[] (TTYPE*) plan->tw_fast;
+}
+
+template<class DTYPE, class CONTEXT, int SIZE>
+sbg_scratch* sbg_plan_scratch_create(const sbg_plan*){
+    sbg_scratch* scratch = new sbg_scratch;
+    scratch->context   = new CONTEXT();
+    scratch->buf_in_R  = new DTYPE[SIZE];
+    scratch->buf_in_I  = new DTYPE[SIZE];
+    scratch->buf_out_R = new DTYPE[SIZE];
+    scratch->buf_out_I = new DTYPE[SIZE];
+    return scratch;
+}
+
+template<class DTYPE, class CONTEXT>
+void sbg_plan_scratch_release(sbg_scratch* scratch){
+    delete   (CONTEXT*) scratch->context;
+    delete[] (DTYPE*) scratch->buf_in_R;
+    delete[] (DTYPE*) scratch->buf_in_I;
+    delete[] (DTYPE*) scratch->buf_out_R;
+    delete[] (DTYPE*) scratch->buf_out_I;
+    delete scratch;
+}
+
+/**
+ * @brief Registry entry : binds a plan to one sbg_radix_fft instantiation
+ */
+template<sbg_dtype DT, int SIZE, int RADIX, int SW, int GROUP>
+struct sbg_plan_entry {
+    typedef typename sbg_dtype_traits<DT>::DTYPE DTYPE;
+    typedef typename sbg_dtype_traits<DT>::TTYPE TTYPE;
+    typedef typename sbg_dtype_traits<DT>::ITYPE ITYPE;
+    typedef sbg_perm_traits<SIZE, RADIX, SW>     perm_t;
+    typedef sbg_plan_configs<perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE, SW, ceillog2(SIZE), ceillog2(SW)> configs_t;
+    typedef sbg_radix_ctx<DTYPE, SIZE, RADIX, SW> context_t;
+
+    static void bind(sbg_plan* plan){
+        configs_t* configs = new configs_t;
+        configs->dig_rev   = perm_t::dig_rev_config();
+        configs->stride    = perm_t::stride_config();
+        fft_sbg_radix_perm_table_compile<SIZE>(configs->dig_rev, configs->dig_rev_table);
+        fft_sbg_radix_perm_table_compile<SIZE>(configs->stride, configs->stride_table);
+        fft_sbg_radix_perm_table_compile<SIZE>(perm_t::tail_stride_config(), configs->tail_stride_table);
+        fft_sbg_radix_dig_rev_index<SIZE, RADIX>(configs->dig_rev_index);
+
+        TTYPE* tw_R = new TTYPE[SIZE];
+        TTYPE* tw_I = new TTYPE[SIZE];
+        sbg_plan_twiddles(plan, tw_R, tw_I);
+        TTYPE* tw_stream = new TTYPE[fft_sbg_radix_tw_stream_length(SIZE, RADIX, SW)];
+        fft_sbg_radix_tw_stream_fill<TTYPE, SIZE, RADIX, SW>(tw_R, tw_I, tw_stream);
+        TTYPE* tw_fast = new TTYPE[fft_sbg_radix_tw_stream_length(SIZE, RADIX, fft_sbg_radix_fast_width(SIZE))];
+        fft_sbg_radix_tw_stream_fill<TTYPE, SIZE, RADIX, fft_sbg_radix_fast_width(SIZE)>(tw_R, tw_I, tw_fast);
+
+        plan->kernel    = &sbg_plan_kernel_impl<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE>;
+        plan->kernel_fixed = sbg_plan_fixed_io<DT>::template kernel<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE>();
+        plan->kernel_double = sbg_plan_double_io<DT>::template kernel<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE>();
+        plan->kernel_window = &sbg_plan_window_kernel_impl<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE>;
+        plan->kernel_conv = &sbg_plan_conv_kernel_impl<DTYPE, TTYPE, ITYPE, SIZE, RADIX, SW, GROUP, perm_t::DIGIT_REV_NUM_STAGE, perm_t::STRIDE_PERM_SWITCH_NUM_STAGE>;
+        plan->release   = &sbg_plan_release<TTYPE, configs_t>;
+        plan->prune_fill = &sbg_plan_prune_fill<SIZE, RADIX, configs_t>;
+        plan->scratch_create  = &sbg_plan_scratch_create<DTYPE, context_t, SIZE>;
+        plan->scratch_release = &sbg_plan_scratch_release<DTYPE, context_t>;
+        plan->spectrum_create  = &sbg_plan_spectrum_create<TTYPE>;
+        plan->spectrum_release = &sbg_plan_spectrum_release<TTYPE>;
+        plan->configs   = configs;
+        plan->tw_R      = tw_R;
+        plan->tw_I      = tw_I;
+        plan->tw_stream = tw_stream;
+        plan->tw_fast   = tw_fast;
+        plan->scratch   = plan->scratch_create(plan);
+    }
+};
+
+//
+// Dense table indexed by (log2(SIZE), log2(RADIX), log2(SW), GROUP) : one table per datapath type
+//
+
+typedef void (*sbg_plan_bind_fn)(sbg_plan* plan);
+
+constexpr int SBG_REGISTRY_LOG2N_MAX  = 16;
+constexpr int SBG_REGISTRY_LOG2R_MAX  = 4;
+constexpr int SBG_REGISTRY_LOG2SW_MAX = 5;
+constexpr int SBG_REGISTRY_GROUP_MAX  = 12;
+constexpr int SBG_REGISTRY_SIZE       = (SBG_REGISTRY_LOG2N_MAX+1) * SBG_REGISTRY_LOG2R_MAX * (SBG_REGISTRY_LOG2SW_MAX+1) * SBG_REGISTRY_GROUP_MAX;
+
+typedef std::array<sbg_plan_bind_fn, SBG_REGISTRY_SIZE> sbg_registry_table;
+
+constexpr bool sbg_is_pow2(int x){
+    return (x > 0) && ((x & (x-1)) == 0);
+}
+
+/**
+ * @brief Position of a configuration in the registry tables, -1 when it cannot be represented
+ */
+constexpr int sbg_registry_index(int SIZE, int RADIX, int SW, int GROUP){
+    if( !sbg_is_pow2(SIZE) || !sbg_is_pow2(RADIX) || !sbg_is_pow2(SW) || (RADIX < 2) )
+        return -1;
+    const int log2n  = floorlog2(SIZE);
+    const int log2r  = floorlog2(RADIX);
+    const int log2sw = floorlog2(SW);
+    if( (log2n > SBG_REGISTRY_LOG2N_MAX) || (log2r > SBG_REGISTRY_LOG2R_MAX) || (log2sw > SBG_REGISTRY_LOG2SW_MAX) || (GROUP < 1) || (GROUP > SBG_REGISTRY_GROUP_MAX) )
+        return -1;
+    return ((log2n * SBG_REGISTRY_LOG2R_MAX + (log2r-1)) * (SBG_REGISTRY_LOG2SW_MAX+1) + log2sw) * SBG_REGISTRY_GROUP_MAX + (GROUP-1);
+}
+
+constexpr bool sbg_registry_keys_unique(){
+    for(int i = 0; i < SBG_REGISTRY_NUM_CONFIGS * SBG_REGISTRY_NUM_GROUPS; i++)
+        for(int j = i+1; j < SBG_REGISTRY_NUM_CONFIGS * SBG_REGISTRY_NUM_GROUPS; j++)
+            if( sbg_registry_index(sbg_radix_configs[i / SBG_REGISTRY_NUM_GROUPS].SIZE, sbg_radix_configs[i / SBG_REGISTRY_NUM_GROUPS].RADIX, sbg_radix_configs[i / SBG_REGISTRY_NUM_GROUPS].SW, sbg_radix_groups[i % SBG_REGISTRY_NUM_GROUPS])
+             == sbg_registry_index(sbg_radix_configs[j / SBG_REGISTRY_NUM_GROUPS].SIZE, sbg_radix_configs[j / SBG_REGISTRY_NUM_GROUPS].RADIX, sbg_radix_configs[j / SBG_REGISTRY_NUM_GROUPS].SW, sbg_radix_groups[j % SBG_REGISTRY_NUM_GROUPS]) )
+                return false;
+    return true;
+}
+static_assert(sbg_registry_keys_unique(), "SBG_RADIX_CONFIGS contains the same configuration twice");
+
+template<sbg_dtype DT>
+struct sbg_registry {
+    template<std::size_t I>
+    static constexpr int index(){
+        return sbg_registry_index(sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].SIZE, sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].RADIX,
+                                  sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].SW,   sbg_radix_groups [I % SBG_REGISTRY_NUM_GROUPS]);
+    }
+
+    template<std::size_t I>
+    static constexpr sbg_plan_bind_fn entry(){
+        static_assert(index<I>() >= 0, "configuration out of the registry range");
+        return &sbg_plan_entry<DT, sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].SIZE, sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].RADIX,
+                                   sbg_radix_configs[I / SBG_REGISTRY_NUM_GROUPS].SW,   sbg_radix_groups [I % SBG_REGISTRY_NUM_GROUPS]>::bind;
+    }
+
+    template<std::size_t... I>
+    static constexpr sbg_registry_table build(std::index_sequence<I...>){
+        sbg_registry_table table{};
+        ((table[index<I>()] = entry<I>()), ...);
+        return table;
+    }
+
+    static constexpr sbg_registry_table table(){
+        return build(std::make_index_sequence<SBG_REGISTRY_NUM_CONFIGS * SBG_REGISTRY_NUM_GROUPS>{});
+    }
+};
+
+extern const sbg_registry_table sbg_registry_float;
+extern const sbg_registry_table sbg_registry_fixed;
+extern const sbg_registry_table sbg_registry_fast_fixed;
+extern const sbg_registry_table sbg_registry_double;
+
+/**
+ * @brief Bind function of a configuration, nullptr when it is not instantiated
+ */
+sbg_plan_bind_fn sbg_registry_lookup(const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_dtype dtype);
+
+#endif // LIB_FFT_SBG_RADIX_REGISTRY_HPP_
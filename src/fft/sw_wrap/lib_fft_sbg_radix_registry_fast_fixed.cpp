@@ -0,0 +1,13 @@
+/**
+ * @file lib_fft_sbg_radix_registry_fast_fixed.cpp
+ * @brief This file instantiates the native integer fixed point datapath entries of the plan registry
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include "lib_fft_sbg_radix_registry.hpp"
+
+constexpr sbg_registry_table sbg_registry_fast_fixed = sbg_registry<SBG_DTYPE_FAST_FIXED>::table();
@@ -0,0 +1,133 @@
+/**
+ * @file lib_fft_sbg_radix_stft.cpp
+ * @brief This file contains the streaming short-time Fourier transform built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+#include "lib_fft_sbg_radix_stft.hpp"
+
+sbg_window sbg_window_from_name(const std::string& name){
+    if( name == "rect"     ) return SBG_WINDOW_RECT;
+    if( name == "hann"     ) return SBG_WINDOW_HANN;
+    if( name == "blackman" ) return SBG_WINDOW_BLACKMAN;
+    if( name == "kaiser"   ) return SBG_WINDOW_KAISER;
+    std::cout << "(EE) Error in sbg_window_from_name function, unknown window [" << name << "] (rect, hann, blackman or kaiser) !" << std::endl;
+    exit( EXIT_FAILURE );
+}
+
+// Modified Bessel function of the first kind, order 0 : the series converges for the usual Kaiser shapes (beta < 20)
+static double sbg_bessel_i0(const double x){
+    double sum  = 1.0;
+    double term = 1.0;
+    for(int k = 1; k < 64; k++){
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum  += term;
+        if( term < 1e-12 * sum )
+            break;
+    }
+    return sum;
+}
+
+void sbg_window_fill(const sbg_window type, const int32_t SIZE, float* window, const float beta){
+    for(int n = 0; n < SIZE; n++){
+        const double phase = 2.0 * M_PI * n / SIZE;
+        switch( type ){
+            case SBG_WINDOW_RECT     : window[n] = 1.0f; break;
+            case SBG_WINDOW_HANN     : window[n] = 0.5 - 0.5 * std::cos(phase); break;
+            case SBG_WINDOW_BLACKMAN : window[n] = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase); break;
+            case SBG_WINDOW_KAISER   : {
+                const double r = 2.0 * n / SIZE - 1.0;
+                window[n] = sbg_bessel_i0(beta * std::sqrt(1.0 - r * r)) / sbg_bessel_i0(beta);
+                break;
+            }
+        }
+    }
+}
+
+sbg_stft* sbg_stft_create(const int32_t SIZE, const int32_t HOP, const sbg_window type, const float beta, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types){
+    if( HOP <= 0 ){
+        std::cout << "(EE) Error in sbg_stft_create function, the hop (" << HOP << ") must be positive !" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    int32_t CAPACITY = 1;
+    while( CAPACITY < 2*SIZE )
+        CAPACITY *= 2;
+
+    sbg_stft* stft = new sbg_stft();
+    stft->SIZE     = SIZE;
+    stft->HOP      = HOP;
+    stft->CAPACITY = CAPACITY;
+    stft->plan     = sbg_plan_create(SIZE, RADIX, SW, GROUP, types);
+    stft->window   = new float[SIZE];
+    stft->ring_R   = new float[CAPACITY];
+    stft->ring_I   = new float[CAPACITY];
+    sbg_window_fill(type, SIZE, stft->window, beta);
+    sbg_stft_reset(stft);
+    return stft;
+}
+
+int32_t sbg_stft_max_frames(const sbg_stft* stft, const int32_t count){
+    return count / stft->HOP + 1;
+}
+
+int32_t sbg_stft_push(sbg_stft* stft, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I){
+    const int32_t SIZE = stft->SIZE;
+    const int32_t mask = stft->CAPACITY - 1;
+    int32_t frames = 0;
+
+    int32_t consumed = 0;
+    while( consumed < count ){
+        // samples between two frames (HOP > SIZE) are not kept
+        if( stft->written < stft->next ){
+            const int32_t skip = std::min<int64_t>(count - consumed, stft->next - stft->written);
+            stft->written += skip;
+            consumed      += skip;
+            continue;
+        }
+
+        // the ring holds the pending samples of the next frame, the remaining room is filled
+        const int32_t room = stft->CAPACITY - (stft->written - stft->next);
+        const int32_t n    = std::min(count - consumed, room);
+        for(int i = 0; i < n; i++){
+            const int32_t pos = (stft->written + i) & mask;
+            stft->ring_R[pos] = in_R[consumed + i];
+            stft->ring_I[pos] = in_I[consumed + i];
+        }
+        stft->written += n;
+        consumed      += n;
+
+        while( stft->written - stft->next >= SIZE ){
+            sbg_plan_execute_window(stft->plan, stft->ring_R, stft->ring_I, mask, stft->next & mask, stft->window, out_R, out_I);
+            out_R      += SIZE;
+            out_I      += SIZE;
+            stft->next += stft->HOP;
+            frames++;
+        }
+    }
+    return frames;
+}
+
+void sbg_stft_reset(sbg_stft* stft){
+    stft->written = 0;
+    stft->next    = 0;
+}
+
+void sbg_stft_destroy(sbg_stft* stft){
+    if( stft == nullptr )
+        return;
+    sbg_plan_destroy(stft->plan);
+    delete[] stft->window;
+    delete[] stft->ring_R;
+    delete[] stft->ring_I;
+    delete stft;
+}
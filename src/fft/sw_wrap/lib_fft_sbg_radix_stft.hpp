@@ -0,0 +1,100 @@
+/**
+ * @file lib_fft_sbg_radix_stft.hpp
+ * @brief This file contains the streaming short-time Fourier transform built on the sbg-radix plans
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_STFT_HPP_
+#define LIB_FFT_SBG_RADIX_STFT_HPP_
+
+#include <cstdint>
+#include <string>
+#include "lib_fft_sbg_radix_plan.hpp"
+
+/**
+ * @brief Analysis windows of the STFT, in their periodic (DFT-even) form
+ */
+enum sbg_window {
+    SBG_WINDOW_RECT,
+    SBG_WINDOW_HANN,        // 0.5 - 0.5.cos(2.pi.n/N)
+    SBG_WINDOW_BLACKMAN,    // 0.42 - 0.5.cos(2.pi.n/N) + 0.08.cos(4.pi.n/N)
+    SBG_WINDOW_KAISER       // I0(beta.sqrt(1 - (2n/N - 1)^2)) / I0(beta)
+};
+
+/**
+ * @brief Window selected by its command line name : rect, hann, blackman or kaiser
+ */
+sbg_window sbg_window_from_name(const std::string& name);
+
+/**
+ * @brief Coefficients of a SIZE points window
+ *
+ * @param beta Shape of the Kaiser window, ignored by the other ones
+ */
+void sbg_window_fill(const sbg_window type, const int32_t SIZE, float* window, const float beta = 8.6f);
+
+/**
+ * @brief Streaming STFT : frames of SIZE samples every HOP samples of a continuous stream
+ *
+ * The stream is written once in a ring buffer of CAPACITY samples (a power of two >= 2.SIZE) and each frame is read
+ * in place by the plan (sbg_plan_execute_window), the window being applied by the pass that converts the samples to
+ * the datapath format. The overlap between frames is never copied, and the samples that no frame covers
+ * (HOP > SIZE) are skipped. The stream can be pushed by blocks of any length.
+ *
+ */
+struct sbg_stft {
+    int32_t         SIZE;       // frame length
+    int32_t         HOP;        // distance between the first samples of two frames
+    int32_t         CAPACITY;   // ring length
+    sbg_plan*       plan;
+    float*          window;
+    float*          ring_R;
+    float*          ring_I;
+    int64_t         written;    // stream samples written in the ring
+    int64_t         next;       // stream position of the next frame
+};
+
+/**
+ * @brief Create a streaming STFT
+ *
+ * @param SIZE  Frame length (FFT size)
+ * @param HOP   Distance between frames, in samples
+ * @param type  Analysis window
+ * @param beta  Shape of the Kaiser window
+ * @param RADIX Core radix of the plan
+ * @param SW    Streaming width of the plan
+ * @param GROUP Number of stages per group
+ * @param types Numeric configuration
+ * @return sbg_stft* STFT to release with sbg_stft_destroy
+ */
+sbg_stft* sbg_stft_create(const int32_t SIZE, const int32_t HOP, const sbg_window type, const float beta, const int32_t RADIX, const int32_t SW, const int32_t GROUP, const sbg_types types);
+
+/**
+ * @brief Largest number of frames that a push of count samples can give
+ */
+int32_t sbg_stft_max_frames(const sbg_stft* stft, const int32_t count);
+
+/**
+ * @brief Push count samples of the stream, and compute the frames they complete
+ *
+ * @param in_R  Samples (real)
+ * @param in_I  Samples (imag)
+ * @param count Number of samples
+ * @param out_R Spectra of the completed frames (real), SIZE bins each, room for sbg_stft_max_frames(count) frames
+ * @param out_I Spectra (imag)
+ * @return int32_t Number of frames computed
+ */
+int32_t sbg_stft_push(sbg_stft* stft, const float* in_R, const float* in_I, const int32_t count, float* out_R, float* out_I);
+
+/**
+ * @brief Forget the stream : the next pushed sample starts a new frame
+ */
+void sbg_stft_reset(sbg_stft* stft);
+
+void sbg_stft_destroy(sbg_stft* stft);
+
+#endif // LIB_FFT_SBG_RADIX_STFT_HPP_
@@ -0,0 +1,67 @@
+/**
+ * @file lib_fft_sbg_radix_transpose.cpp
+ * @brief This file contains the tiled transpose shared by the multi-dimensional and decomposed transforms
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#include <algorithm>
+#include "lib_fft_sbg_radix_transpose.hpp"
+#include "../../common/dft_simd.hpp"
+
+/**
+ * @brief Transpose of the tile [r0, r1) x [c0, c1) of one plane
+ */
+static void sbg_transpose_tile(const float* src, float* dst, const int32_t rows, const int32_t cols, const int32_t r0, const int32_t r1, const int32_t c0, const int32_t c1){
+    int32_t r = r0;
+    if( transpose_simd<float>::enabled ){
+        for(; r + 8 <= r1; r += 8){
+            int32_t c = c0;
+            for(; c + 8 <= c1; c += 8)
+                transpose_simd<float>::run(src + (int64_t) r * cols + c, cols, dst + (int64_t) c * rows + r, rows);
+            for(; c < c1; c++)
+                for(int32_t i = r; i < r + 8; i++)
+                    dst[(int64_t) c * rows + i] = src[(int64_t) i * cols + c];
+        }
+    }
+    for(; r < r1; r++)
+        for(int32_t c = c0; c < c1; c++)
+            dst[(int64_t) c * rows + r] = src[(int64_t) r * cols + c];
+}
+
+void sbg_transpose(sbg_pool& pool, const float* src_R, const float* src_I, float* dst_R, float* dst_I, const int32_t rows, const int32_t cols,
+                   const float* tw_R, const float* tw_I, const float scale){
+    const int64_t row_tiles = (rows + SBG_TRANSPOSE_TILE - 1) / SBG_TRANSPOSE_TILE;
+    const bool plain = (tw_R == nullptr) && (scale == 1.0f);
+
+    pool.parallel_for(row_tiles, 1, [&](const int32_t, const int64_t first, const int64_t last){
+        for(int64_t t = first; t < last; t++){
+            const int32_t r0 = t * SBG_TRANSPOSE_TILE;
+            const int32_t r1 = std::min(rows, r0 + SBG_TRANSPOSE_TILE);
+            for(int32_t c0 = 0; c0 < cols; c0 += SBG_TRANSPOSE_TILE){
+                const int32_t c1 = std::min(cols, c0 + SBG_TRANSPOSE_TILE);
+                if( plain ){
+                    sbg_transpose_tile(src_R, dst_R, rows, cols, r0, r1, c0, c1);
+                    sbg_transpose_tile(src_I, dst_I, rows, cols, r0, r1, c0, c1);
+                    continue;
+                }
+                for(int32_t r = r0; r < r1; r++){
+                    for(int32_t c = c0; c < c1; c++){
+                        const int64_t s = (int64_t) r * cols + c;
+                        const int64_t d = (int64_t) c * rows + r;
+                        if( tw_R != nullptr ){
+                            dst_R[d] = (src_R[s] * tw_R[s] - src_I[s] * tw_I[s]) * scale;
+                            dst_I[d] = (src_R[s] * tw_I[s] + src_I[s] * tw_R[s]) * scale;
+                        }else{
+                            dst_R[d] = src_R[s] * scale;
+                            dst_I[d] = src_I[s] * scale;
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
@@ -0,0 +1,42 @@
+/**
+ * @file lib_fft_sbg_radix_transpose.hpp
+ * @brief This file contains the tiled transpose shared by the multi-dimensional and decomposed transforms
+ * @version 0.0.0
+ * @date 2026-10-17
+ *
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ *
+ */
+
+#ifndef LIB_FFT_SBG_RADIX_TRANSPOSE_HPP_
+#define LIB_FFT_SBG_RADIX_TRANSPOSE_HPP_
+
+#include <cstdint>
+#include "lib_fft_sbg_radix_pool.hpp"
+
+/**
+ * @brief Tile edge of the transposes : two 32x32 float tiles per plane stay in L1
+ */
+constexpr int32_t SBG_TRANSPOSE_TILE = 32;
+
+/**
+ * @brief Complex transpose dst (cols x rows) = src (rows x cols), out of place
+ *
+ * The matrices are walked by SBG_TRANSPOSE_TILE square tiles, the rows of tiles being spread over the pool workers.
+ * Without twiddles nor scaling, the tiles are moved by 8x8 SIMD blocks when the host provides them (transpose_simd).
+ *
+ * @param pool  Workers
+ * @param src_R Source (real), rows x cols
+ * @param src_I Source (imag)
+ * @param dst_R Destination (real), cols x rows
+ * @param dst_I Destination (imag)
+ * @param rows  Source rows
+ * @param cols  Source columns
+ * @param tw_R  Optional factors multiplying each element, in the source order (real)
+ * @param tw_I  Optional factors (imag)
+ * @param scale Real factor applied to each element
+ */
+void sbg_transpose(sbg_pool& pool, const float* src_R, const float* src_I, float* dst_R, float* dst_I, const int32_t rows, const int32_t cols,
+                   const float* tw_R = nullptr, const float* tw_I = nullptr, const float scale = 1.0f);
+
+#endif // LIB_FFT_SBG_RADIX_TRANSPOSE_HPP_
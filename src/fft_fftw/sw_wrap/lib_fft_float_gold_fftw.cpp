@@ -31,44 +31,61 @@
 void lib_fft_float_gold_fftw(DataVector& data, Parameters& p){
 
     const int32_t FFT_SIZE = p.toInt("FFT_SIZE");
+    const int32_t LENGTH   = data.I.size();
     const std::string q_input    = p.toString("q_input");
+    const std::string inverse    = p.exist("inverse") ? p.toString("inverse") : "none";
 
-    std::vector<double> samples_i(FFT_SIZE);
-    std::vector<double> samples_q(FFT_SIZE);
+    std::vector<double> samples_i(LENGTH);
+    std::vector<double> samples_q(LENGTH);
     std::vector<double> fft_i(FFT_SIZE);
     std::vector<double> fft_q(FFT_SIZE);
 
     if((q_input == "double") || (q_input == "float")){
-        for(int i = 0; i < FFT_SIZE; i++){
+        for(int i = 0; i < LENGTH; i++){
             samples_i[i] = data.I[i];
             samples_q[i] = data.Q[i];//samples_in_Q.read();
         }
     }
     else{
         const uint8_t Q_in = p.toInt("q_input");
-        for(int i = 0; i < FFT_SIZE; i++){
+        for(int i = 0; i < LENGTH; i++){
             samples_i[i] = std::round(data.I[i]*(1 << (Q_in-1)));
             samples_q[i] = std::round(data.Q[i]*(1 << (Q_in-1)));//samples_in_Q.read();
         }
     }
 
+    // inverse transform : the real and imaginary parts are swapped at the input and the output of the forward one
+    std::vector<double>& in_i  = (inverse == "none") ? samples_i : samples_q;
+    std::vector<double>& in_q  = (inverse == "none") ? samples_q : samples_i;
+    std::vector<double>& out_i = (inverse == "none") ? fft_i : fft_q;
+    std::vector<double>& out_q = (inverse == "none") ? fft_q : fft_i;
+
     fft_fftw3 fft(FFT_SIZE);
-    fft.load(0, samples_i, samples_q);
-    fft.process();
-    fft.store(fft_i, fft_q);
-    
-    if((q_input == "double") || (q_input == "float")){
-        for(int i = 0; i < FFT_SIZE; i++){
-            data.I[i]=fft_i[i];
-            data.Q[i]=fft_q[i];
+    for(int f = 0; f + FFT_SIZE <= LENGTH; f += FFT_SIZE){
+        fft.load(f, in_i, in_q);
+        fft.process();
+        fft.store(out_i, out_q);
+
+        if(inverse == "scaled"){
+            for(int i = 0; i < FFT_SIZE; i++){
+                fft_i[i] /= FFT_SIZE;
+                fft_q[i] /= FFT_SIZE;
+            }
         }
-    }
-    else{    
-        const uint8_t Q_in = p.toInt("q_input");
-        for(int i = 0; i < FFT_SIZE; i++){
-            data.I[i]=fft_i[i]/(1<<(Q_in-1));
-            data.Q[i]=fft_q[i]/(1<<(Q_in-1));
+
+        if((q_input == "double") || (q_input == "float")){
+            for(int i = 0; i < FFT_SIZE; i++){
+                data.I[f+i]=fft_i[i];
+                data.Q[f+i]=fft_q[i];
+            }
+        }
+        else{
+            const uint8_t Q_in = p.toInt("q_input");
+            for(int i = 0; i < FFT_SIZE; i++){
+                data.I[f+i]=fft_i[i]/(1<<(Q_in-1));
+                data.Q[f+i]=fft_q[i]/(1<<(Q_in-1));
+            }
         }
     }
-    
+
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include <sstream>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include "../common/Parameters.hpp"
 #include "../common/DataVector.hpp"
 
@@ -69,6 +70,22 @@ int main(int argc, char* argv[])
     param.set("q_rom_dir",  "float");
     param.set("SW",         "none");
     param.set("RADIX",      "none");
+    param.set("FFT_SIZE",   "none");
+    param.set("fixed_model", "fast-fixed");
+    param.set("engine",     "fast");
+    param.set("THREADS",    "1");
+    param.set("real",       "none");
+    param.set("inverse",    "none");
+    param.set("ROWS",       "1");
+    param.set("STFT_HOP",   "0");
+    param.set("window",     "hann");
+    param.set("kaiser_beta", "8.6");
+    param.set("fir",        "none");
+    param.set("conv",       "save");
+    param.set("chan",       "none");
+    param.set("CHAN_TAPS",  "8");
+    param.set("VALID_INPUTS", "none");
+    param.set("bins",       "none");
 
 
     for (uint32_t p = 1; p < argc; p++) {
@@ -106,6 +123,86 @@ int main(int argc, char* argv[])
         } else if (cmde == "--radix") {
             param.set("RADIX", arg1);
             p += 1;
+        } else if (cmde == "--fft-size") {
+            param.set("FFT_SIZE", arg1);
+            p += 1;
+        } else if (cmde == "--fixed-model") {
+            if( (arg1 != "ap-int") && (arg1 != "fast-fixed") ){
+                printf("(EE) Unknown fixed point model => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("fixed_model", arg1);
+            p += 1;
+        } else if (cmde == "--engine") {
+            if( (arg1 != "fast") && (arg1 != "model") && (arg1 != "validate") ){
+                printf("(EE) Unknown engine => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("engine", arg1);
+            p += 1;
+        } else if (cmde == "--threads") {
+            param.set("THREADS", arg1);
+            p += 1;
+        } else if (cmde == "--real") {
+            if( (arg1 != "half") && (arg1 != "pair") ){
+                printf("(EE) Unknown real mode => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("real", arg1);
+            p += 1;
+        } else if (cmde == "--inverse") {
+            if( (arg1 != "raw") && (arg1 != "scaled") ){
+                printf("(EE) Unknown inverse mode => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("inverse", arg1);
+            p += 1;
+        } else if (cmde == "--fft-2d") {
+            param.set("ROWS", arg1);
+            p += 1;
+        } else if (cmde == "--stft") {
+            param.set("STFT_HOP", arg1);
+            p += 1;
+        } else if (cmde == "--window") {
+            if( (arg1 != "rect") && (arg1 != "hann") && (arg1 != "blackman") && (arg1 != "kaiser") ){
+                printf("(EE) Unknown window => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("window", arg1);
+            p += 1;
+        } else if (cmde == "--kaiser-beta") {
+            param.set("kaiser_beta", arg1);
+            p += 1;
+        } else if (cmde == "--fir") {
+            param.set("fir", arg1);
+            p += 1;
+        } else if (cmde == "--conv") {
+            if( (arg1 != "save") && (arg1 != "add") ){
+                printf("(EE) Unknown convolution method => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("conv", arg1);
+            p += 1;
+        } else if (cmde == "--channelize") {
+            if( (arg1 != "critical") && (arg1 != "oversampled") ){
+                printf("(EE) Unknown channelizer mode => [%s]\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("chan", arg1);
+            p += 1;
+        } else if (cmde == "--chan-taps") {
+            param.set("CHAN_TAPS", arg1);
+            p += 1;
+        } else if (cmde == "--valid-inputs") {
+            param.set("VALID_INPUTS", arg1);
+            p += 1;
+        } else if (cmde == "--bins") {
+            if( arg1.find(':') == std::string::npos ){
+                printf("(EE) Unknown bin range => [%s] (first:last)\n", arg1.c_str());
+                exit(0);
+            }
+            param.set("bins", arg1);
+            p += 1;
         }else {
             printf("(EE) Unknown argument (%d) => [%s]\n", p, cmde.c_str());
             printf("(EE) Error in %s %d\n", __FILE__, __LINE__);
@@ -144,11 +241,68 @@ int main(int argc, char* argv[])
 
     DataVector  ii( param.toString("ifile") );
 
-    const int32_t SIZE  = ii.I.size();
+    // With --fir the input file is a stream filtered by the taps of the given file, by blocks of FFT_SIZE points
+    const bool fir = (param.toString("fir") != "none");
+    const DataVector taps = fir ? DataVector( param.toString("fir") ) : DataVector( ii );
+    if(fir && (param.toString("FFT_SIZE") == "none")){
+        param.set("FFT_SIZE", sbg_conv_fft_size(taps.I.size()));
+    }
+
+    // With --channelize the input file is a stream split into FFT_SIZE channels, decimated by FFT_SIZE or FFT_SIZE/2
+    const bool chan = (param.toString("chan") != "none");
+    if(chan && (param.toString("FFT_SIZE") == "none")){
+        std::cout << "(EE) Please specify the number of channels (--fft-size)" << std::endl;
+        return -1;
+    }
+
+    // Without --fft-size the whole input file is one frame, otherwise it holds consecutive frames
+    if(param.toString("FFT_SIZE") == "none"){
+        param.set("FFT_SIZE", (int32_t) ii.I.size());
+    }
+    const int32_t SIZE  = param.toInt("FFT_SIZE");
     const int32_t LOG2  = std::log2(SIZE);
-    param.set("FFT_SIZE", SIZE);
+    // With --stft the input file is a stream, cut into frames of SIZE samples every HOP samples
+    const int32_t HOP   = param.toInt("STFT_HOP");
+    if((HOP > 0) && ((SIZE <= 0) || (ii.I.size() < (size_t) SIZE))){
+        std::cout << "(EE) The input signal length (" << ii.I.size() << ") is shorter than one STFT frame (" << SIZE << ")" << std::endl;
+        return -1;
+    }
+    if((HOP == 0) && !fir && !chan && ((SIZE <= 0) || (ii.I.size() % SIZE != 0))){
+        std::cout << "(EE) The input signal length (" << ii.I.size() << ") is not a multiple of the FFT size (" << SIZE << ")" << std::endl;
+        return -1;
+    }
+    const int32_t DECIM = (param.toString("chan") == "oversampled") ? SIZE / 2 : SIZE;
+    if(chan && ((SIZE < 2) || (ii.I.size() < (size_t) DECIM))){
+        std::cout << "(EE) The input signal length (" << ii.I.size() << ") is shorter than one channelizer frame (" << DECIM << ")" << std::endl;
+        return -1;
+    }
+    param.set("FFT_FRAMES", (int32_t) ((HOP > 0) ? (ii.I.size() - SIZE) / HOP + 1 : (chan ? ii.I.size() / DECIM : (ii.I.size() + SIZE - 1) / SIZE)));
+
+    // With --fft-2d each frame holds ROWS rows of COLS samples, row-major
+    const int32_t ROWS = param.toInt("ROWS");
+    const int32_t COLS = SIZE / ROWS;
+    if((ROWS <= 0) || (ROWS * COLS != SIZE)){
+        std::cout << "(EE) The FFT size (" << SIZE << ") is not a multiple of the number of rows (" << ROWS << ")" << std::endl;
+        return -1;
+    }
     param.set("FFT_LOG2", LOG2);
 
+    // With --valid-inputs and --bins the transforms are pruned : zeros from VALID onward, bins FIRST..LAST kept
+    const bool pruned = (param.toString("VALID_INPUTS") != "none") || (param.toString("bins") != "none");
+    if(param.toString("VALID_INPUTS") == "none"){
+        param.set("VALID_INPUTS", SIZE);
+    }
+    const std::string bins = (param.toString("bins") == "none") ? "0:" + std::to_string(SIZE - 1) : param.toString("bins");
+    param.set("BINS_FIRST", bins.substr(0, bins.find(':')));
+    param.set("BINS_LAST",  bins.substr(bins.find(':') + 1));
+    const int32_t VALID = param.toInt("VALID_INPUTS");
+    const int32_t FIRST = param.toInt("BINS_FIRST");
+    const int32_t LAST  = param.toInt("BINS_LAST");
+    if(pruned && ((VALID < 1) || (VALID > SIZE) || (FIRST < 0) || (FIRST > LAST) || (LAST >= SIZE))){
+        std::cout << "(EE) The pruning (" << VALID << " valid inputs, bins " << FIRST << ":" << LAST << ") does not fit the FFT size (" << SIZE << ")" << std::endl;
+        return -1;
+    }
+
     std::string cfile = param.toString("cfile");
 
     std::string ofile = param.toString("ofile");
@@ -157,9 +311,24 @@ int main(int argc, char* argv[])
     printf("#   - FFT model      : %s\n", param.toString("model").c_str());
     printf("#   - FFT size       : %s\n", param.toString("FFT_SIZE").c_str());
     printf("#   - FFT depth      : %s\n", param.toString("FFT_LOG2").c_str());
+    printf("#   - FFT frames     : %s\n", param.toString("FFT_FRAMES").c_str());
+    printf("#   - Threads        : %s\n", param.toString("THREADS").c_str());
     printf("#   - I/O width      : %s\n", param.toString("q_input"   ).c_str());
     printf("#   - Internal width : %s\n", param.toString("q_internal").c_str());
     printf("#   - COS/SIN  width : %s\n", param.toString("q_rom"     ).c_str());
+    printf("#   - Fixed model    : %s\n", param.toString("fixed_model").c_str());
+    printf("#   - Engine         : %s\n", param.toString("engine").c_str());
+    printf("#   - Real input     : %s\n", param.toString("real").c_str());
+    printf("#   - Inverse        : %s\n", param.toString("inverse").c_str());
+    printf("#   - 2D rows        : %s\n", param.toString("ROWS").c_str());
+    printf("#   - STFT hop       : %s\n", param.toString("STFT_HOP").c_str());
+    printf("#   - STFT window    : %s\n", param.toString("window").c_str());
+    printf("#   - FIR taps       : %s\n", param.toString("fir").c_str());
+    printf("#   - FIR method     : %s\n", param.toString("conv").c_str());
+    printf("#   - Channelizer    : %s\n", param.toString("chan").c_str());
+    printf("#   - Taps / branch  : %s\n", param.toString("CHAN_TAPS").c_str());
+    printf("#   - Valid inputs   : %s\n", param.toString("VALID_INPUTS").c_str());
+    printf("#   - Output bins    : %s\n", bins.c_str());
     printf("#\n");
     printf("#  + I/O file configuration :\n");
     printf("#   - LUT values   : %s\n", param.toString("cfile").c_str());
@@ -170,9 +339,179 @@ int main(int argc, char* argv[])
     printf("#  > Launching FFT computation\n");
 
     const std::string fft_model = param.toString("model");
-    if( fft_model == "sbg-radix" ) {
+    const std::string real = param.toString("real");
+    if( (real != "none") && (param.toString("inverse") != "none") ){
+        std::cout << "(EE) The real input modes only compute forward transforms" << std::endl;
+        return -1;
+    }
+    if( (real != "none") && (ROWS != 1) ){
+        std::cout << "(EE) The real input modes only compute one-dimensional transforms" << std::endl;
+        return -1;
+    }
+    if( (HOP > 0) && ((real != "none") || (ROWS != 1) || (param.toString("inverse") != "none")) ){
+        std::cout << "(EE) The STFT mode only computes forward one-dimensional complex transforms" << std::endl;
+        return -1;
+    }
+    if( fir && ((HOP > 0) || (real != "none") || (ROWS != 1) || (param.toString("inverse") != "none")) ){
+        std::cout << "(EE) The FIR mode cannot be combined with the other modes" << std::endl;
+        return -1;
+    }
+    if( chan && (fir || (HOP > 0) || (real != "none") || (ROWS != 1) || (param.toString("inverse") != "none")) ){
+        std::cout << "(EE) The channelizer mode cannot be combined with the other modes" << std::endl;
+        return -1;
+    }
+    if( pruned && (fir || chan || (HOP > 0) || (real != "none") || (ROWS != 1)) ){
+        std::cout << "(EE) The pruned transforms cannot be combined with the other modes" << std::endl;
+        return -1;
+    }
+    if( (fft_model == "sbg-radix") && chan ) {
+        lib_fft_sbg_radix_load_fft_roms( cfile, SIZE );
+        lib_sbg_radix_channelize(ii, param);
+    }else if( (fft_model == "fftw-gold") && chan ) {
+        // reference of the channelizer mode : each channel shifted down, filtered by the prototype and decimated,
+        // in the direct form accumulated in double, the channel streams one after the other
+        const int32_t P      = param.toInt("CHAN_TAPS");
+        const int32_t L      = SIZE * P;
+        const int32_t FRAMES = ii.I.size() / DECIM;
+        std::vector<float> h(L);
+        sbg_chan_prototype(SIZE, P, param.toFloat("kaiser_beta"), h.data());
+        DataVector channels(ii);
+        channels.I.assign((size_t) SIZE * FRAMES, 0.0f);
+        channels.Q.assign((size_t) SIZE * FRAMES, 0.0f);
+        for(int k = 0; k < SIZE; k++){
+            for(int m = 0; m < FRAMES; m++){
+                const int64_t t = (int64_t) (m + 1) * DECIM - 1;
+                double acc_R = 0.0, acc_I = 0.0;
+                for(int n = 0; (n < L) && (n <= t); n++){
+                    const double phase = -2.0 * M_PI * (((int64_t) k * (t - n)) % SIZE) / SIZE;
+                    const double x_R = h[n] * ii.I[t - n];
+                    const double x_I = h[n] * ii.Q[t - n];
+                    acc_R += x_R * std::cos(phase) - x_I * std::sin(phase);
+                    acc_I += x_R * std::sin(phase) + x_I * std::cos(phase);
+                }
+                channels.I[(size_t) k * FRAMES + m] = acc_R;
+                channels.Q[(size_t) k * FRAMES + m] = acc_I;
+            }
+        }
+        ii.I.swap(channels.I);
+        ii.Q.swap(channels.Q);
+    }else if( (fft_model == "sbg-radix") && fir ) {
+        lib_fft_sbg_radix_load_fft_roms( cfile, SIZE );
+        lib_sbg_radix_fir(ii, taps, param);
+    }else if( (fft_model == "fftw-gold") && fir ) {
+        // reference of the FIR mode : direct form, accumulated in double
+        DataVector filtered(ii);
+        const int32_t TAPS = taps.I.size();
+        for(size_t n = 0; n < ii.I.size(); n++){
+            double acc_R = 0.0, acc_I = 0.0;
+            for(int k = 0; (k < TAPS) && (k <= (int64_t) n); k++){
+                acc_R += (double) taps.I[k] * ii.I[n-k] - (double) taps.Q[k] * ii.Q[n-k];
+                acc_I += (double) taps.I[k] * ii.Q[n-k] + (double) taps.Q[k] * ii.I[n-k];
+            }
+            filtered.I[n] = acc_R;
+            filtered.Q[n] = acc_I;
+        }
+        ii.I.swap(filtered.I);
+        ii.Q.swap(filtered.Q);
+    }else if( (fft_model == "sbg-radix") && (HOP > 0) ) {
+        lib_fft_sbg_radix_load_fft_roms( cfile, SIZE );
+        lib_sbg_radix_stft(ii, param);
+    }else if( (fft_model == "fftw-gold") && (HOP > 0) ) {
+        // reference of the STFT mode : windowed frames cut from the stream, then transformed one by one
+        std::vector<float> window(SIZE);
+        sbg_window_fill(sbg_window_from_name(param.toString("window")), SIZE, window.data(), param.toFloat("kaiser_beta"));
+        DataVector frames(ii);
+        frames.I.clear();
+        frames.Q.clear();
+        for(size_t f = 0; f + SIZE <= ii.I.size(); f += HOP){
+            for(int n = 0; n < SIZE; n++){
+                frames.I.push_back(ii.I[f + n] * window[n]);
+                frames.Q.push_back(ii.Q[f + n] * window[n]);
+            }
+        }
+        ii.I.swap(frames.I);
+        ii.Q.swap(frames.Q);
+        lib_fft_float_gold_fftw(ii, param);
+    }else if( (fft_model == "sbg-radix") && (ROWS != 1) ) {
+        // the plans of both dimensions are served by the ROM of the longest one
+        lib_fft_sbg_radix_load_fft_roms( cfile, std::max(ROWS, COLS) );
+        lib_sbg_radix_fft2d(ii, param);
+    }else if( (fft_model == "sbg-radix") && (real != "none") ) {
         lib_fft_sbg_radix_load_fft_roms( cfile, SIZE );
+        lib_sbg_radix_rfft(ii, param);
+    }else if( fft_model == "sbg-radix" ) {
+        // the lengths that are not a power of two and the very large ones run on plans of another size
+        lib_fft_sbg_radix_load_fft_roms( cfile, lib_sbg_radix_rom_size(SIZE) );
         lib_sbg_radix_fft(ii, param);
+    }else if( (fft_model == "fftw-gold") && (real == "half") ) {
+        // reference of the real input mode : imaginary part cleared, SIZE/2+1 first bins of each frame
+        std::fill(ii.Q.begin(), ii.Q.end(), 0.0f);
+        lib_fft_float_gold_fftw(ii, param);
+        DataVector half(ii);
+        half.I.clear();
+        half.Q.clear();
+        for(size_t f = 0; f < ii.I.size(); f += SIZE){
+            half.I.insert(half.I.end(), ii.I.begin() + f, ii.I.begin() + f + SIZE/2 + 1);
+            half.Q.insert(half.Q.end(), ii.Q.begin() + f, ii.Q.begin() + f + SIZE/2 + 1);
+        }
+        ii.I.swap(half.I);
+        ii.Q.swap(half.Q);
+    }else if( (fft_model == "fftw-gold") && (real == "pair") ) {
+        // reference of the paired real input mode : real and imaginary parts transformed apart, SIZE/2+1 first bins of both per frame
+        DataVector x(ii), y(ii);
+        y.I = ii.Q;
+        std::fill(x.Q.begin(), x.Q.end(), 0.0f);
+        std::fill(y.Q.begin(), y.Q.end(), 0.0f);
+        lib_fft_float_gold_fftw(x, param);
+        lib_fft_float_gold_fftw(y, param);
+        ii.I.clear();
+        ii.Q.clear();
+        for(size_t f = 0; f < x.I.size(); f += SIZE){
+            ii.I.insert(ii.I.end(), x.I.begin() + f, x.I.begin() + f + SIZE/2 + 1);
+            ii.I.insert(ii.I.end(), y.I.begin() + f, y.I.begin() + f + SIZE/2 + 1);
+            ii.Q.insert(ii.Q.end(), x.Q.begin() + f, x.Q.begin() + f + SIZE/2 + 1);
+            ii.Q.insert(ii.Q.end(), y.Q.begin() + f, y.Q.begin() + f + SIZE/2 + 1);
+        }
+    }else if( (fft_model == "fftw-gold") && (ROWS != 1) ) {
+        // reference of the 2D mode : transforms of the rows, then of the columns through two transposes
+        Parameters pass(param);
+        DataVector tr(ii);
+        pass.set("FFT_SIZE", COLS);
+        lib_fft_float_gold_fftw(ii, pass);
+        for(int dir = 0; dir < 2; dir++){
+            const int32_t R = (dir == 0) ? ROWS : COLS;
+            const int32_t C = (dir == 0) ? COLS : ROWS;
+            for(size_t f = 0; f < ii.I.size(); f += SIZE){
+                for(int r = 0; r < R; r++){
+                    for(int c = 0; c < C; c++){
+                        tr.I[f + c*R + r] = ii.I[f + r*C + c];
+                        tr.Q[f + c*R + r] = ii.Q[f + r*C + c];
+                    }
+                }
+            }
+            std::swap(ii.I, tr.I);
+            std::swap(ii.Q, tr.Q);
+            if( dir == 0 ){
+                pass.set("FFT_SIZE", ROWS);
+                lib_fft_float_gold_fftw(ii, pass);
+            }
+        }
+    }else if( (fft_model == "fftw-gold") && pruned ) {
+        // reference of the pruned transforms : samples cleared from VALID onward, bins FIRST..LAST of each frame
+        for(size_t f = 0; f < ii.I.size(); f += SIZE){
+            std::fill(ii.I.begin() + f + VALID, ii.I.begin() + f + SIZE, 0.0f);
+            std::fill(ii.Q.begin() + f + VALID, ii.Q.begin() + f + SIZE, 0.0f);
+        }
+        lib_fft_float_gold_fftw(ii, param);
+        DataVector band(ii);
+        band.I.clear();
+        band.Q.clear();
+        for(size_t f = 0; f < ii.I.size(); f += SIZE){
+            band.I.insert(band.I.end(), ii.I.begin() + f + FIRST, ii.I.begin() + f + LAST + 1);
+            band.Q.insert(band.Q.end(), ii.Q.begin() + f + FIRST, ii.Q.begin() + f + LAST + 1);
+        }
+        ii.I.swap(band.I);
+        ii.Q.swap(band.Q);
     }else if( fft_model == "fftw-gold" ) {
         lib_fft_float_gold_fftw(ii, param);
     }else{
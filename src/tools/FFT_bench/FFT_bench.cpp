@@ -0,0 +1,338 @@
+/**
+ * @file FFT_bench.cpp
+ * @brief This tool measures the throughput of the sbg-radix software model on batches of frames
+ * @version 0.0.0
+ * @date 2026-10-17
+ * 
+ * @license This source is released under the GNU GENERAL PUBLIC LICENSE Version 3
+ * 
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+#include <sstream>
+#include "../../common/Parameters.hpp"
+#include "../../fft/sw_wrap/lib_fft_sbg_radix.hpp"
+
+/**
+ * @brief Throughput of a TAPS taps FIR filter on a stream of FRAMES.SIZE samples : direct form, overlap-save and
+ * overlap-add with SIZE points transforms. The direct form is timed on a prefix of the stream.
+ */
+static void bench_fir(const int32_t TAPS, const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int64_t FRAMES, const sbg_types types, const sbg_engine engine){
+    const int64_t LENGTH = FRAMES * SIZE;
+    const int64_t DIRECT = std::min<int64_t>(LENGTH, 65536);
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> h_R(TAPS), h_I(TAPS);
+    for(int k = 0; k < TAPS; k++){
+        h_R[k] = dist(gen) / TAPS;
+        h_I[k] = dist(gen) / TAPS;
+    }
+    // the stream is preceded by TAPS-1 zeros for the direct form
+    std::vector<float> x_R(LENGTH + TAPS - 1, 0.0f), x_I(LENGTH + TAPS - 1, 0.0f);
+    for(int64_t i = TAPS - 1; i < LENGTH + TAPS - 1; i++){
+        x_R[i] = dist(gen);
+        x_I[i] = dist(gen);
+    }
+    std::vector<float> y_R(LENGTH + 2 * SIZE), y_I(LENGTH + 2 * SIZE);
+
+    printf("# FIR : %d taps, %ld samples, %d points transforms\n", TAPS, (long) LENGTH, SIZE);
+    printf("# method             time(s)   Msamples/s    speedup\n");
+
+    // direct form, taps reversed so that each output is a forward dot product
+    std::vector<float> r_R(h_R.rbegin(), h_R.rend()), r_I(h_I.rbegin(), h_I.rend());
+    auto start = std::chrono::steady_clock::now();
+    for(int64_t n = 0; n < DIRECT; n++){
+        float acc_R = 0.0f, acc_I = 0.0f;
+        for(int j = 0; j < TAPS; j++){
+            acc_R += r_R[j] * x_R[n + j] - r_I[j] * x_I[n + j];
+            acc_I += r_R[j] * x_I[n + j] + r_I[j] * x_R[n + j];
+        }
+        y_R[n] = acc_R;
+        y_I[n] = acc_I;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    const double direct = DIRECT / std::chrono::duration<double>(stop - start).count();
+    printf("direct        %12.4f %12.2f %10.2f\n", std::chrono::duration<double>(stop - start).count(), direct / 1e6, 1.0);
+
+    const sbg_conv_method methods[] = {SBG_CONV_OVERLAP_SAVE, SBG_CONV_OVERLAP_ADD};
+    for(const sbg_conv_method method : methods){
+        sbg_conv* conv = sbg_conv_create(h_R.data(), h_I.data(), TAPS, SIZE, method, RADIX, SW, 2, types);
+        sbg_plan_set_engine(conv->plan, engine);
+        constexpr const int32_t CHUNK = 4096;
+        int64_t produced = 0;
+        start = std::chrono::steady_clock::now();
+        for(int64_t i = 0; i < LENGTH; i += CHUNK){
+            const int32_t n = std::min<int64_t>(CHUNK, LENGTH - i);
+            produced += sbg_conv_push(conv, x_R.data() + TAPS - 1 + i, x_I.data() + TAPS - 1 + i, n, y_R.data() + produced, y_I.data() + produced);
+        }
+        stop = std::chrono::steady_clock::now();
+        sbg_conv_destroy(conv);
+
+        const double elapsed = std::chrono::duration<double>(stop - start).count();
+        printf("%-13s %12.4f %12.2f %10.2f\n", (method == SBG_CONV_OVERLAP_SAVE) ? "overlap-save" : "overlap-add", elapsed, LENGTH / elapsed / 1e6, LENGTH / elapsed / direct);
+    }
+}
+
+/**
+ * @brief Throughput of a SIZE channels polyphase channelizer with P taps per branch on a stream of FRAMES.SIZE
+ * samples, critically sampled and 2x oversampled. The share of the transforms is measured by running the plan alone
+ * on the same number of frames.
+ */
+static void bench_chan(const int32_t P, const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int64_t FRAMES, const sbg_types types, const sbg_engine engine){
+    const int64_t LENGTH = FRAMES * SIZE;
+
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> x_R(LENGTH), x_I(LENGTH);
+    for(int64_t i = 0; i < LENGTH; i++){
+        x_R[i] = dist(gen);
+        x_I[i] = dist(gen);
+    }
+    std::vector<float> h(SIZE * P);
+    sbg_chan_prototype(SIZE, P, 8.6f, h.data());
+
+    printf("# Channelizer : %d channels, %d taps per branch, %ld samples\n", SIZE, P, (long) LENGTH);
+    printf("# mode               time(s)   Msamples/s    fft share\n");
+
+    const sbg_chan_mode modes[] = {SBG_CHAN_CRITICAL, SBG_CHAN_OVERSAMPLED};
+    for(const sbg_chan_mode mode : modes){
+        sbg_chan* chan = sbg_chan_create(SIZE, P, mode, h.data(), RADIX, SW, 2, types);
+        sbg_plan_set_engine(chan->plan, engine);
+        constexpr const int32_t CHUNK = 4096;
+        const int64_t stride = sbg_chan_max_frames(chan, CHUNK);
+        std::vector<float> y_R(stride * SIZE), y_I(stride * SIZE);
+        int64_t frames = 0;
+        auto start = std::chrono::steady_clock::now();
+        for(int64_t i = 0; i < LENGTH; i += CHUNK){
+            const int32_t n = std::min<int64_t>(CHUNK, LENGTH - i);
+            frames += sbg_chan_push(chan, x_R.data() + i, x_I.data() + i, n, y_R.data(), y_I.data(), stride);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        const double elapsed = std::chrono::duration<double>(stop - start).count();
+
+        // the transforms alone, on frames of the stream
+        start = std::chrono::steady_clock::now();
+        for(int64_t f = 0; f < frames; f++){
+            const int64_t offset = (f * SIZE) % (LENGTH - SIZE + 1);
+            sbg_plan_execute(chan->plan, x_R.data() + offset, x_I.data() + offset, y_R.data(), y_I.data());
+        }
+        stop = std::chrono::steady_clock::now();
+        const double fft = std::chrono::duration<double>(stop - start).count();
+        sbg_chan_destroy(chan);
+
+        printf("%-13s %12.4f %12.2f %12.2f\n", (mode == SBG_CHAN_CRITICAL) ? "critical" : "oversampled", elapsed, LENGTH / elapsed / 1e6, fft / elapsed);
+    }
+}
+
+/**
+ * @brief Throughput of a pruned transform against the whole one, on FRAMES frames whose samples from VALID onward
+ * are zero and of which only the bins FIRST..LAST are read. The packets column is the share of the packets of the
+ * fast engine that still go through the twiddling and dft.
+ */
+static void bench_prune(const int32_t VALID, const int32_t FIRST, const int32_t LAST, const int32_t SIZE, const int32_t RADIX, const int32_t SW, const int64_t FRAMES, const sbg_types types, const sbg_engine engine){
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> x_R(SIZE * FRAMES, 0.0f), x_I(SIZE * FRAMES, 0.0f);
+    std::vector<float> y_R(SIZE * FRAMES), y_I(SIZE * FRAMES);
+    for(int64_t f = 0; f < FRAMES; f++){
+        for(int i = 0; i < VALID; i++){
+            x_R[f * SIZE + i] = dist(gen) / SIZE;
+            x_I[f * SIZE + i] = dist(gen) / SIZE;
+        }
+    }
+    const sbg_frames frames = {x_R.data(), x_I.data(), y_R.data(), y_I.data()};
+
+    printf("# Pruned FFT : %d valid inputs, bins %d:%d\n", VALID, FIRST, LAST);
+    printf("# transform          time(s)     frames/s      packets    speedup\n");
+
+    sbg_plan* plan = sbg_plan_create(SIZE, RADIX, SW, 2, types);
+    sbg_plan_set_engine(plan, engine);
+    sbg_pool pool(1);
+    double reference = 0.0;
+    for(int pruned = 0; pruned < 2; pruned++){
+        if( pruned )
+            sbg_plan_set_pruning(plan, VALID, FIRST, LAST);
+        const double packets = pruned ? (double) plan->prune->computed / plan->prune->packets : 1.0;
+        sbg_batch_execute(plan, frames, 1, pool); // warm-up
+
+        const auto start = std::chrono::steady_clock::now();
+        sbg_batch_execute(plan, frames, FRAMES, pool);
+        const auto stop  = std::chrono::steady_clock::now();
+
+        const double elapsed = std::chrono::duration<double>(stop - start).count();
+        if( !pruned )
+            reference = elapsed;
+        printf("%-13s %12.4f %12.1f %12.2f %10.2f\n", pruned ? "pruned" : "whole", elapsed, FRAMES / elapsed, packets, reference / elapsed);
+    }
+    sbg_plan_destroy(plan);
+}
+
+int main(int argc, char* argv[])
+{
+    printf("# FFT model throughput benchmark\n");
+    printf("#  + Binary generated : %s - %s\n", __DATE__, __TIME__);
+
+    Parameters param;
+    param.set("cfile",      "none");
+    param.set("FFT_SIZE",   "none");
+    param.set("RADIX",      "4");
+    param.set("SW",         "8");
+    param.set("FRAMES",     "4096");
+    param.set("THREADS",    "0");
+    param.set("q_input",    "float");
+    param.set("q_rom",      "float");
+    param.set("q_internal", "float");
+    param.set("fixed_model", "fast-fixed");
+    param.set("engine",     "fast");
+    param.set("FIR_TAPS",   "0");
+    param.set("CHAN_TAPS",  "0");
+    param.set("VALID_INPUTS", "none");
+    param.set("bins",       "none");
+
+    for (int p = 1; p < argc; p += 1) {
+        std::string cmde = argv[p];
+        if( p + 1 >= argc ){
+            printf("(EE) Missing value for argument (%d) => [%s]\n", p, cmde.c_str());
+            exit( EXIT_FAILURE );
+        }
+        std::string arg1 = argv[p+1];
+        if        (cmde == "--constants") {
+            param.set("cfile", arg1);
+        } else if (cmde == "--fft-size") {
+            param.set("FFT_SIZE", arg1);
+        } else if (cmde == "--radix") {
+            param.set("RADIX", arg1);
+        } else if (cmde == "--sw") {
+            param.set("SW", arg1);
+        } else if (cmde == "--frames") {
+            param.set("FRAMES", arg1);
+        } else if (cmde == "--threads") {
+            param.set("THREADS", arg1);
+        } else if (cmde == "--input-quantif") {
+            param.set("q_input", arg1);
+        } else if (cmde == "--rom-quantif") {
+            param.set("q_rom", arg1);
+        } else if (cmde == "--internal-quantif") {
+            param.set("q_internal", arg1);
+        } else if (cmde == "--fixed-model") {
+            param.set("fixed_model", arg1);
+        } else if (cmde == "--engine") {
+            param.set("engine", arg1);
+        } else if (cmde == "--fir") {
+            param.set("FIR_TAPS", arg1);
+        } else if (cmde == "--channelize") {
+            param.set("CHAN_TAPS", arg1);
+        } else if (cmde == "--valid-inputs") {
+            param.set("VALID_INPUTS", arg1);
+        } else if (cmde == "--bins") {
+            param.set("bins", arg1);
+        } else {
+            printf("(EE) Unknown argument (%d) => [%s]\n", p, cmde.c_str());
+            exit( EXIT_FAILURE );
+        }
+        p += 1;
+    }
+
+    if(param.toString("cfile") == "none"){
+        std::cout << "usage : FFT_bench --constants <twiddle_factor_directory> [--fft-size <N>] [--radix <R>] [--sw <SW[,SW...]>] [--frames <FRAMES>] [--threads <MAX_THREADS>] [--input-quantif <INPUT_WIDTH> --rom-quantif <TWIDDLE_WIDTH>] [--internal-quantif <float|double>] [--fixed-model <fast-fixed|ap-int>] [--engine <fast|model|validate>] [--fir <TAPS>] [--channelize <TAPS_PER_BRANCH>] [--valid-inputs <V>] [--bins <FIRST:LAST>]" << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    // --fir : FIR filtering of a stream by fast convolution, against the direct form
+    const int32_t TAPS    = param.toInt("FIR_TAPS");
+    if(param.toString("FFT_SIZE") == "none"){
+        param.set("FFT_SIZE", (TAPS > 0) ? sbg_conv_fft_size(TAPS) : 1024);
+    }
+    const int32_t SIZE    = param.toInt("FFT_SIZE");
+    const int32_t RADIX   = param.toInt("RADIX");
+    std::vector<int32_t> widths; // --sw 8,16,32 : one measurement per streaming width
+    std::stringstream sw_list(param.toString("SW"));
+    for(std::string w; std::getline(sw_list, w, ',');)
+        widths.push_back(std::stoi(w));
+    const int64_t FRAMES  = param.toLong("FRAMES");
+    const int32_t THREADS = (param.toInt("THREADS") > 0) ? param.toInt("THREADS") : std::max(1u, std::thread::hardware_concurrency());
+
+    sbg_types types = {(param.toString("q_internal") == "double") ? SBG_DTYPE_DOUBLE : SBG_DTYPE_FLOAT, 0, 0};
+    if( param.toString("q_rom") != "float" ){
+        types.internal = (param.toString("fixed_model") == "ap-int") ? SBG_DTYPE_FIXED : SBG_DTYPE_FAST_FIXED;
+        types.q_input  = param.toInt("q_input");
+        types.q_rom    = param.toInt("q_rom");
+    }
+
+    printf("#  + Configuration :\n");
+    printf("#   - FFT size       : %d\n", SIZE);
+    printf("#   - Radix          : %d\n", RADIX);
+    printf("#   - Streaming width: %s\n", param.toString("SW").c_str());
+    printf("#   - Frames         : %ld\n", (long) FRAMES);
+    printf("#   - Datapath       : %s\n", (types.internal == SBG_DTYPE_FLOAT) ? "float" : ((types.internal == SBG_DTYPE_DOUBLE) ? "double" : param.toString("fixed_model").c_str()));
+    printf("#   - Engine         : %s\n", param.toString("engine").c_str());
+    printf("#\n");
+
+    lib_fft_sbg_radix_load_fft_roms(param.toString("cfile"), SIZE);
+
+    // --channelize : polyphase channelizer of FFT_SIZE channels
+    if( param.toInt("CHAN_TAPS") > 0 ){
+        bench_chan(param.toInt("CHAN_TAPS"), SIZE, RADIX, widths[0], FRAMES, types, sbg_engine_from_name(param.toString("engine")));
+        return 0;
+    }
+
+    // --valid-inputs, --bins : pruned transforms against the whole ones
+    if( (param.toString("VALID_INPUTS") != "none") || (param.toString("bins") != "none") ){
+        const std::string bins = (param.toString("bins") == "none") ? "0:" + std::to_string(SIZE - 1) : param.toString("bins");
+        const int32_t VALID = (param.toString("VALID_INPUTS") == "none") ? SIZE : param.toInt("VALID_INPUTS");
+        bench_prune(VALID, std::stoi(bins.substr(0, bins.find(':'))), std::stoi(bins.substr(bins.find(':') + 1)), SIZE, RADIX, widths[0], FRAMES, types, sbg_engine_from_name(param.toString("engine")));
+        return 0;
+    }
+
+    if( TAPS > 0 ){
+        bench_fir(TAPS, SIZE, RADIX, widths[0], FRAMES, types, sbg_engine_from_name(param.toString("engine")));
+        return 0;
+    }
+
+    // Inputs within [-1, 1[ so that the fixed point datapaths do not saturate
+    std::vector<float> in_R(SIZE * FRAMES), in_I(SIZE * FRAMES);
+    std::vector<float> out_R(SIZE * FRAMES), out_I(SIZE * FRAMES);
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for(int64_t i = 0; i < SIZE * FRAMES; i++){
+        in_R[i] = dist(gen) / SIZE;
+        in_I[i] = dist(gen) / SIZE;
+    }
+    const sbg_frames frames = {in_R.data(), in_I.data(), out_R.data(), out_I.data()};
+
+    for(const int32_t SW : widths){
+        sbg_plan* plan = sbg_plan_create(SIZE, RADIX, SW, 2, types);
+        sbg_plan_set_engine(plan, sbg_engine_from_name(param.toString("engine")));
+
+        // Msamples/s divided by SW is the clock the streaming architecture needs to keep up with the software
+        printf("# SW = %d\n", SW);
+        printf("# threads      time(s)     frames/s   Msamples/s    speedup   efficiency\n");
+        double reference = 0.0;
+        for(int32_t t = 1; t <= THREADS; t = (t < THREADS) ? std::min(2 * t, THREADS) : THREADS + 1){
+            sbg_pool pool(t);
+            sbg_batch_execute(plan, frames, std::min<int64_t>(FRAMES, pool.size()), pool); // warm-up
+
+            const auto start = std::chrono::steady_clock::now();
+            sbg_batch_execute(plan, frames, FRAMES, pool);
+            const auto stop  = std::chrono::steady_clock::now();
+
+            const double elapsed = std::chrono::duration<double>(stop - start).count();
+            const double rate    = FRAMES / elapsed;
+            if( t == 1 )
+                reference = rate;
+            printf("%9d %12.4f %12.1f %12.2f %10.2f %12.2f\n", t, elapsed, rate, rate * SIZE / 1e6, rate / reference, rate / reference / t);
+        }
+
+        sbg_plan_destroy(plan);
+    }
+    return 0;
+}
@@ -78,7 +78,7 @@ int main(int argc, char* argv[])
     const double pi = 3.1415926535897932384626433832795;
 
     const int32_t FFT_SIZE_MIN  =     8;
-    const int32_t FFT_SIZE_MAX  = 8192;
+    const int32_t FFT_SIZE_MAX  = 65536;
 
     const int32_t COEF_BIT_MIN  =  8;
     const int32_t COEF_BIT_MAX  = 32;